@@ -118,6 +118,10 @@ public:
     /// This funtion has an implicit stop() if stop() has not been previously called
     void write();
 
+    /// \brief set the arguments of the event, for values that are only known once the event
+    /// has completed. Must be called before the data is written.
+    void set_args(const std::string& args) { m_args = args; }
+
     Duration(const Duration&) = delete;
     Duration& operator=(Duration const&) = delete;
 
@@ -0,0 +1,181 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <map>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SHA1.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "ngraph/codegen/code_cache.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+
+using namespace llvm;
+using namespace std;
+using namespace ngraph;
+
+static atomic<size_t> s_module_loads{0};
+
+// Writes data to path through a temporary file, so that other processes never read a partial
+// entry
+static void write_entry(const string& path, StringRef data)
+{
+    int fd;
+    SmallString<128> temp_path;
+    if (sys::fs::createUniqueFile(path + ".%%%%%%%%.tmp", fd, temp_path))
+    {
+        NGRAPH_WARN << "Could not write codegen cache entry " << path;
+        return;
+    }
+    bool written;
+    {
+        raw_fd_ostream out(fd, true);
+        out << data;
+        out.close();
+        written = !out.has_error();
+        out.clear_error();
+    }
+    if (!written || sys::fs::rename(temp_path, path))
+    {
+        NGRAPH_WARN << "Could not write codegen cache entry " << path;
+        sys::fs::remove(temp_path);
+    }
+}
+
+namespace
+{
+    class CodeCacheObjects : public ObjectCache
+    {
+    public:
+        CodeCacheObjects(const string& directory)
+            : m_directory(directory)
+        {
+        }
+
+        void notifyObjectCompiled(const llvm::Module* module, MemoryBufferRef object) override
+        {
+            write_entry(get_path(module), object.getBuffer());
+        }
+
+        unique_ptr<MemoryBuffer> getObject(const llvm::Module* module) override
+        {
+            auto object = MemoryBuffer::getFile(get_path(module));
+            if (!object)
+            {
+                return nullptr;
+            }
+            return move(*object);
+        }
+
+    private:
+        string get_path(const llvm::Module* module) const
+        {
+            return file_util::path_join(m_directory, module->getModuleIdentifier() + ".o");
+        }
+
+        string m_directory;
+    };
+}
+
+codegen::CodeCache::CodeCache(const string& directory)
+    : m_directory(directory)
+    , m_object_cache(new CodeCacheObjects(directory))
+{
+    if (sys::fs::create_directories(directory))
+    {
+        NGRAPH_WARN << "Could not create codegen cache directory " << directory;
+    }
+}
+
+codegen::CodeCache::~CodeCache()
+{
+}
+
+string codegen::CodeCache::make_key(const string& source, const string& configuration)
+{
+    SHA1 hash;
+    // Prefix every field with its length so that no two sets of fields hash the same data
+    auto add = [&hash](StringRef field) {
+        hash.update(to_string(field.size()) + ":");
+        hash.update(field);
+    };
+
+    add(LLVM_VERSION_STRING);
+    // The JIT generates code for this CPU
+    add(sys::getHostCPUName());
+    StringMap<bool> features;
+    if (sys::getHostCPUFeatures(features))
+    {
+        map<string, bool> sorted_features;
+        for (auto& feature : features)
+        {
+            sorted_features[feature.getKey().str()] = feature.getValue();
+        }
+        for (auto& feature : sorted_features)
+        {
+            add((feature.second ? "+" : "-") + feature.first);
+        }
+    }
+    add(configuration);
+    add(source);
+    return toHex(hash.final(), true);
+}
+
+unique_ptr<llvm::Module> codegen::CodeCache::load_module(const string& key, LLVMContext& context)
+{
+    auto bitcode = MemoryBuffer::getFile(file_util::path_join(m_directory, key + ".bc"));
+    if (!bitcode)
+    {
+        return nullptr;
+    }
+    auto module = parseBitcodeFile((*bitcode)->getMemBufferRef(), context);
+    if (!module)
+    {
+        NGRAPH_WARN << "Ignoring unreadable codegen cache entry " << key << ": "
+                    << toString(module.takeError());
+        return nullptr;
+    }
+    (*module)->setModuleIdentifier(key);
+    s_module_loads++;
+    return move(*module);
+}
+
+void codegen::CodeCache::store_module(const string& key, llvm::Module& module)
+{
+    module.setModuleIdentifier(key);
+    string bitcode;
+    raw_string_ostream out(bitcode);
+    WriteBitcodeToFile(module, out);
+    out.flush();
+    write_entry(file_util::path_join(m_directory, key + ".bc"), bitcode);
+}
+
+size_t codegen::CodeCache::get_module_loads()
+{
+    return s_module_loads;
+}
@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace ngraph
+{
+    namespace codegen
+    {
+        class CodeCache;
+    }
+}
+
+namespace llvm
+{
+    class LLVMContext;
+    class Module;
+    class ObjectCache;
+}
+
+/// \brief Directory of code compiled by earlier processes, addressed by a hash of everything the
+///        code depends on.
+///
+/// An entry holds the LLVM bitcode of a module, which saves running clang, and the object code
+/// the JIT generated from it, which saves code generation. Entries are written through temporary
+/// files, so processes can share a directory. Nothing is ever removed from it.
+class ngraph::codegen::CodeCache
+{
+public:
+    CodeCache(const std::string& directory);
+    ~CodeCache();
+
+    /// \brief Key of the code compiled from source with the given compiler configuration, for
+    ///        the CPU of this host and the LLVM version in use.
+    static std::string make_key(const std::string& source, const std::string& configuration);
+
+    /// \brief Load the module stored under key into context.
+    /// \return The module, with key as its identifier, or nullptr if there is none.
+    std::unique_ptr<llvm::Module> load_module(const std::string& key, llvm::LLVMContext& context);
+
+    /// \brief Store module under key, which becomes its identifier.
+    void store_module(const std::string& key, llvm::Module& module);
+
+    /// \brief Number of modules this process loaded from any cache directory.
+    static size_t get_module_loads();
+
+    /// \brief Object cache for the JIT, which stores the object code of a module under its
+    ///        identifier.
+    llvm::ObjectCache* get_object_cache() { return m_object_cache.get(); }
+
+private:
+    std::string m_directory;
+    std::unique_ptr<llvm::ObjectCache> m_object_cache;
+};
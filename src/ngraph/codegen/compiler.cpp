@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include <clang/Basic/DiagnosticOptions.h>
@@ -35,6 +36,7 @@
 #include <clang/Lex/PreprocessorOptions.h>
 #include <llvm/ADT/Statistic.h>
 #include <llvm/ExecutionEngine/MCJIT.h> // forces JIT to link in
+#include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/LinkAllPasses.h>
 #include <llvm/Option/Arg.h>
@@ -48,6 +50,7 @@
 #include <llvm/Support/raw_ostream.h>
 
 #include "header_resource.hpp"
+#include "ngraph/codegen/code_cache.hpp"
 #include "ngraph/codegen/compiler.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
@@ -74,6 +77,9 @@ using namespace llvm;
 using namespace std;
 using namespace ngraph;
 
+// Declared here because ngraph.hpp cannot be compiled without RTTI
+extern "C" const char* get_ngraph_version_string();
+
 class CompilerInfo
 {
 public:
@@ -96,8 +102,9 @@ public:
     }
 } s_static_init;
 
-codegen::Module::Module(std::unique_ptr<llvm::Module> module)
+codegen::Module::Module(std::unique_ptr<llvm::Module> module, std::shared_ptr<CodeCache> cache)
     : m_module(move(module))
+    , m_cache(cache)
 {
 }
 
@@ -131,8 +138,44 @@ void codegen::Compiler::add_header_search_path(const std::string& path)
     m_header_search_paths.push_back(path);
 }
 
+void codegen::Compiler::set_cache_directory(const std::string& directory)
+{
+    m_cache = directory.empty() ? nullptr : make_shared<CodeCache>(directory);
+}
+
 std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
 {
+    string cache_key;
+    if (m_cache)
+    {
+        // Everything besides the source that changes the code clang generates
+        stringstream configuration;
+        configuration << get_ngraph_version_string() << "\n"
+                      << getenv_bool("NGRAPH_COMPILER_DEBUGINFO_ENABLE") << "\n";
+#if defined(NGRAPH_TBB_ENABLE)
+        configuration << "NGRAPH_TBB_ENABLE\n";
+#endif
+#if defined(NGRAPH_USE_LEGACY_MKLDNN)
+        configuration << "NGRAPH_USE_LEGACY_MKLDNN\n";
+#endif
+        for (const std::string& path : m_header_search_paths)
+        {
+            configuration << path << "\n";
+        }
+        configuration << m_precompiled_header_source;
+        cache_key = CodeCache::make_key(source, configuration.str());
+
+        if (!m_cache_context)
+        {
+            m_cache_context.reset(new LLVMContext());
+        }
+        auto module = m_cache->load_module(cache_key, *m_cache_context);
+        if (module)
+        {
+            return unique_ptr<codegen::Module>(new codegen::Module(move(module), m_cache));
+        }
+    }
+
     // lock_guard<mutex> lock(m_mutex);
     CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
     if (!compiler_info.compiler)
@@ -145,6 +188,12 @@ std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& s
         compiler_info.compiler->set_precompiled_header_source(m_precompiled_header_source);
     }
     auto rc = compiler_info.compiler->compile(m_compiler_action, source);
+    if (rc && m_cache)
+    {
+        auto module = rc->take_module();
+        m_cache->store_module(cache_key, *module);
+        rc.reset(new codegen::Module(move(module), m_cache));
+    }
     return rc;
 }
 
@@ -27,6 +27,7 @@ namespace ngraph
         class Module;
         class Compiler;
         class CompilerCore;
+        class CodeCache;
     }
 }
 
@@ -38,18 +39,22 @@ namespace clang
 
 namespace llvm
 {
+    class LLVMContext;
     class Module;
 }
 
 class ngraph::codegen::Module
 {
 public:
-    Module(std::unique_ptr<llvm::Module> module);
+    Module(std::unique_ptr<llvm::Module> module,
+           std::shared_ptr<CodeCache> cache = std::shared_ptr<CodeCache>());
     ~Module();
     std::unique_ptr<llvm::Module> take_module();
-
+    /// \brief The cache the module is stored in, which also keeps the code generated from it
+    const std::shared_ptr<CodeCache>& get_cache() const { return m_cache; }
 private:
     std::unique_ptr<llvm::Module> m_module;
+    std::shared_ptr<CodeCache> m_cache;
 };
 
 class ngraph::codegen::Compiler
@@ -59,6 +64,9 @@ public:
     ~Compiler();
     void set_precompiled_header_source(const std::string& source);
     void add_header_search_path(const std::string& path);
+    /// \brief Reuse code compiled from the same source by this or another process, through a
+    ///        cache in directory
+    void set_cache_directory(const std::string& directory);
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
 private:
@@ -66,6 +74,9 @@ private:
     std::shared_ptr<CompilerCore> m_compiler_core;
     std::string m_precompiled_header_source;
     std::vector<std::string> m_header_search_paths;
+    std::shared_ptr<CodeCache> m_cache;
+    /// Owns modules loaded from the cache
+    std::unique_ptr<llvm::LLVMContext> m_cache_context;
 };
 
 class ngraph::codegen::CompilerCore
@@ -16,6 +16,7 @@
 
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 
+#include "ngraph/codegen/code_cache.hpp"
 #include "ngraph/codegen/execution_engine.hpp"
 
 using namespace ngraph;
@@ -39,6 +40,7 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
     {
         if (!m_execution_engine)
         {
+            m_cache = module->get_cache();
             m_execution_engine.reset(llvm::EngineBuilder(module->take_module())
                                          .setEngineKind(llvm::EngineKind::JIT)
                                          .setOptLevel(llvm::CodeGenOpt::Aggressive)
@@ -51,6 +53,11 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
             {
                 return false;
             }
+            if (m_cache)
+            {
+                // Object code is looked up and stored when the engine is finalized
+                m_execution_engine->setObjectCache(m_cache->get_object_cache());
+            }
         }
     }
     else
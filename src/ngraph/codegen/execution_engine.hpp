@@ -51,6 +51,8 @@ public:
     }
 
 private:
+    /// Keeps the cache of the module alive while the engine may use it
+    std::shared_ptr<CodeCache> m_cache;
     std::unique_ptr<llvm::ExecutionEngine> m_execution_engine;
     std::string m_jit_error;
 
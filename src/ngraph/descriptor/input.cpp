@@ -50,6 +50,7 @@ descriptor::Input::~Input()
 
 void descriptor::Input::replace_output(Output& new_output)
 {
+    m_node->invalidate_ordered_ops_caches();
     if (m_output != nullptr)
     {
         m_output->remove_input(this);
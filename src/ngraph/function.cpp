@@ -102,17 +102,38 @@ void Function::init()
 
 std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
-    vector<shared_ptr<Node>> nodes;
-    for (auto& r : get_results())
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    vector<shared_ptr<Node>> result;
+    if (!*m_ordered_ops_valid)
     {
-        nodes.push_back(r);
+        vector<shared_ptr<Node>> nodes;
+        for (auto& r : get_results())
+        {
+            nodes.push_back(r);
+        }
+        for (auto& param : get_parameters())
+        {
+            nodes.push_back(param);
+        }
+
+        result = m_topological_sorter(nodes);
+        m_ordered_ops.clear();
+        m_ordered_ops.reserve(result.size());
+        for (auto& node : result)
+        {
+            m_ordered_ops.push_back(node.get());
+        }
+        Node::register_ordered_ops_cache(m_ordered_ops, m_ordered_ops_valid);
+        *m_ordered_ops_valid = true;
+        return result;
     }
-    for (auto& param : get_parameters())
+
+    result.reserve(m_ordered_ops.size());
+    for (Node* node : m_ordered_ops)
     {
-        nodes.push_back(param);
+        result.push_back(node->shared_from_this());
     }
-
-    return m_topological_sorter(nodes);
+    return result;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -236,6 +257,7 @@ std::vector<shared_ptr<Node>> Function::get_ops() const
 
 void Function::replace_node(std::shared_ptr<Node> old, std::shared_ptr<Node> repl)
 {
+    *m_ordered_ops_valid = false;
     ngraph::replace_node(old, repl);
 }
 
@@ -298,9 +320,11 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    *m_ordered_ops_valid = false;
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    *m_ordered_ops_valid = false;
 }
@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -93,6 +94,11 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns the ops of the function in topological order.
+        ///
+        /// The order is cached and only recomputed after an op of the function has had its
+        /// arguments or control dependencies changed, a parameter has been replaced, or the
+        /// topological sort has been changed.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -144,5 +150,12 @@ namespace ngraph
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
+
+        // Cached result of get_ordered_ops(). The pointers are only dereferenced while
+        // m_ordered_ops_valid is set, in which case the function keeps every op alive.
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<Node*> m_ordered_ops;
+        std::shared_ptr<std::atomic<bool>> m_ordered_ops_valid{
+            std::make_shared<std::atomic<bool>>(false)};
     };
 }
@@ -93,5 +93,6 @@ namespace ngraph
 #include "ngraph/shape.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/specialize_function.hpp"
+#include "ngraph/strided_range.hpp"
 #include "ngraph/type.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
@@ -35,6 +36,10 @@ using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
 
+// Guards m_ordered_ops_caches of all nodes. Registration and invalidation are rare compared to
+// graph traversal, so a single lock is sufficient.
+static mutex s_ordered_ops_caches_mutex;
+
 Node::Node(size_t output_size)
     : Node()
 {
@@ -540,6 +545,46 @@ NodeVector Node::get_arguments() const
     return result;
 }
 
+void Node::register_ordered_ops_cache(const std::vector<Node*>& nodes,
+                                      const std::shared_ptr<std::atomic<bool>>& valid)
+{
+    lock_guard<mutex> lock(s_ordered_ops_caches_mutex);
+    for (Node* node : nodes)
+    {
+        auto& caches = node->m_ordered_ops_caches;
+        bool registered = false;
+        auto it = caches.begin();
+        while (it != caches.end())
+        {
+            auto cache = it->lock();
+            if (!cache)
+            {
+                it = caches.erase(it);
+                continue;
+            }
+            registered = registered || cache == valid;
+            ++it;
+        }
+        if (!registered)
+        {
+            caches.push_back(valid);
+        }
+    }
+}
+
+void Node::invalidate_ordered_ops_caches()
+{
+    lock_guard<mutex> lock(s_ordered_ops_caches_mutex);
+    for (auto& cache : m_ordered_ops_caches)
+    {
+        if (auto valid = cache.lock())
+        {
+            *valid = false;
+        }
+    }
+    m_ordered_ops_caches.clear();
+}
+
 const std::vector<std::shared_ptr<Node>>& Node::get_control_dependencies() const
 {
     return m_control_dependencies;
@@ -555,6 +600,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) ==
         m_control_dependencies.end())
     {
+        invalidate_ordered_ops_caches();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
@@ -592,6 +638,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end())
         {
+            invalidate_ordered_ops_caches();
             m_control_dependencies.erase(it);
         }
     }
@@ -614,6 +661,10 @@ void Node::clear_control_dependencies()
             node->m_control_dependents.erase(it);
         }
     }
+    if (!m_control_dependencies.empty())
+    {
+        invalidate_ordered_ops_caches();
+    }
     m_control_dependencies.clear();
 }
 
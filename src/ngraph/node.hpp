@@ -121,6 +121,9 @@ namespace ngraph
         template <typename NodeType>
         friend class Output;
 
+        // For access to the ordered ops cache registration.
+        friend class Function;
+
     public:
         /// Throws if the node is invalid.
         virtual void validate_and_infer_types();
@@ -273,6 +276,8 @@ namespace ngraph
         virtual bool is_dynamic() const;
         virtual bool has_state() const { return false; }
         size_t get_instance_id() const { return m_instance_id; }
+        /// \brief Returns the number of nodes constructed so far by the process
+        static size_t get_instance_count() { return m_next_instance_id; }
         /// \brief Writes a description of a node to a stream
         /// \param os The stream; should be returned
         /// \param depth How many levels of inputs to describe
@@ -530,6 +535,14 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        /// \brief Registers the validity flag of a Function's cached topological order with
+        ///        every node in `nodes`, so that changing a node's arguments or control
+        ///        dependencies invalidates the cache.
+        static void register_ordered_ops_cache(const std::vector<Node*>& nodes,
+                                               const std::shared_ptr<std::atomic<bool>>& valid);
+        /// \brief Marks every cached topological order containing this node as stale.
+        void invalidate_ordered_ops_caches();
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
         std::string m_node_type;
@@ -546,6 +559,7 @@ namespace ngraph
         size_t m_placement_index = placement_invalid;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        std::vector<std::weak_ptr<std::atomic<bool>>> m_ordered_ops_caches;
     };
 
     using NodeTypeInfo = Node::type_info_t;
@@ -299,6 +299,23 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    NODE_VALIDATION_CHECK(this,
+                          m_data && m_data->size() >= shape_size(m_shape) * m_element_type.size(),
+                          "Constant buffer is smaller than a tensor of shape ",
+                          m_shape,
+                          " and type ",
+                          m_element_type);
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
 op::Constant::Constant(const Constant& other)
     : m_element_type(other.m_element_type)
     , m_shape(other.m_shape)
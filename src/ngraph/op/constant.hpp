@@ -93,6 +93,17 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant that uses the supplied buffer without
+                ///        copying it
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data A buffer holding the constant data, such as a
+                ///             runtime::SharedBuffer over a memory mapped file.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data);
+
                 Constant(const Constant& other);
 
                 virtual ~Constant() override;
@@ -280,6 +291,9 @@ namespace ngraph
                 }
 
                 const void* get_data_ptr() const { return (m_data ? m_data->get_ptr() : nullptr); }
+                /// \brief Returns the buffer holding the data, which may be shared with other
+                ///        constants and must not be modified
+                const std::shared_ptr<runtime::AlignedBuffer>& get_data() const { return m_data; }
                 template <typename T>
                 const T* get_data_ptr() const
                 {
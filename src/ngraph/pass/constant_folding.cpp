@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "constant_folding.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -31,3 +32,16 @@ bool ngraph::pass::revalidate_and_ensure_static(shared_ptr<Node> n)
     }
     return true;
 }
+
+bool pass::ConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    if (runtime::ThreadPool::get_current() != nullptr)
+    {
+        return GraphRewrite::run_on_function(f);
+    }
+    // Owned by this run so that no threads outlive it. Its workers only start if a folder
+    // splits its work, so small graphs start no threads.
+    runtime::ThreadPool pool;
+    runtime::ThreadPool::Scope scope(&pool);
+    return GraphRewrite::run_on_function(f);
+}
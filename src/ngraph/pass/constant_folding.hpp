@@ -148,6 +148,10 @@ public:
         }
     }
 
+    /// Folders of large constants split their work with runtime::parallel_for. They run on
+    /// the ThreadPool the caller has made current, or else on a pool started for this run.
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
 private:
     void construct_constant_reshape();
     void construct_constant_broadcast();
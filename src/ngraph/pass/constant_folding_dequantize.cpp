@@ -28,18 +28,17 @@ shared_ptr<op::Constant> fold_constant_dequantize(shared_ptr<op::Constant> const
                                                   shared_ptr<op::Constant> offset)
 {
     const Shape& out_shape = constant->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(REAL));
-    REAL* data_ptr = buffer.get_ptr<REAL>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(REAL));
 
-    runtime::reference::dequantize<QUANT, REAL>(constant->get_vector<QUANT>().data(),
-                                                scale->get_vector<REAL>().data(),
-                                                offset->get_vector<QUANT>().data(),
-                                                data_ptr,
+    runtime::reference::dequantize<QUANT, REAL>(constant->get_data_ptr<QUANT>(),
+                                                scale->get_data_ptr<REAL>(),
+                                                offset->get_data_ptr<QUANT>(),
+                                                buffer->get_ptr<REAL>(),
                                                 constant->get_shape(),
                                                 scale->get_shape(),
                                                 dequant->get_axes());
 
-    return make_shared<op::Constant>(dequant->get_element_type(), out_shape, data_ptr);
+    return make_shared<op::Constant>(dequant->get_element_type(), out_shape, buffer);
 }
 
 void pass::ConstantFolding::construct_constant_dequantize()
@@ -27,8 +27,8 @@ shared_ptr<op::Constant> fold_constant_reshape(shared_ptr<op::Constant> constant
                                                NodeExecutorTy func)
 {
     const Shape& out_shape = reshape->get_shape();
-    runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
-    T* data_ptr = buffer.get_ptr<T>();
+    auto buffer = make_shared<runtime::AlignedBuffer>(shape_size(out_shape) * sizeof(T));
+    T* data_ptr = buffer->get_ptr<T>();
 
     if (func != nullptr)
     {
@@ -48,7 +48,7 @@ shared_ptr<op::Constant> fold_constant_reshape(shared_ptr<op::Constant> constant
                                         out_shape);
     }
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, data_ptr);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, buffer);
 }
 
 void pass::ConstantFolding::construct_constant_reshape()
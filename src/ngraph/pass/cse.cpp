@@ -14,12 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <typeinfo>
 #include <unordered_map>
 
 #include "cse.hpp"
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -66,41 +69,6 @@ using namespace ngraph;
 
 #define TI(x) type_index(typeid(x))
 
-static bool cse_constant(shared_ptr<Node> a, shared_ptr<Node> b)
-{
-    NGRAPH_DEBUG << "In cse_constant for " << a->get_name() << " and " << b->get_name();
-
-    if (a->get_shape() != b->get_shape() || a->get_element_type() != b->get_element_type())
-    {
-        return false;
-    }
-
-    const op::Constant* ca = static_cast<op::Constant*>(a.get());
-    const op::Constant* cb = static_cast<op::Constant*>(b.get());
-
-    size_t size = shape_size(a->get_shape()) * a->get_element_type().size();
-
-    if (ca->get_all_data_elements_bitwise_identical() ||
-        cb->get_all_data_elements_bitwise_identical())
-    {
-        if (ca->get_all_data_elements_bitwise_identical() &&
-            cb->get_all_data_elements_bitwise_identical())
-        {
-            // Since both Constants are uniform we only need to compare a single element
-            return !memcmp(ca->get_data_ptr(), cb->get_data_ptr(), a->get_element_type().size());
-        }
-        else
-        {
-            return false;
-        }
-    }
-    else
-    {
-        // Neither Constant is uniform so compare all elements
-        return !memcmp(ca->get_data_ptr(), cb->get_data_ptr(), size);
-    }
-}
-
 static bool cse_reshape(shared_ptr<Node> a, shared_ptr<Node> b)
 {
     NGRAPH_DEBUG << "In cse_reshape for " << a->get_name() << " and " << b->get_name();
@@ -113,18 +81,6 @@ static bool cse_reshape(shared_ptr<Node> a, shared_ptr<Node> b)
            (reshape_a->get_output_shape() == reshape_b->get_output_shape());
 }
 
-static bool cse_broadcast(shared_ptr<Node> a, shared_ptr<Node> b)
-{
-    NGRAPH_DEBUG << "In cse_broadcast for " << a->get_name() << " and " << b->get_name();
-
-    const op::Broadcast* broadcast_a = static_cast<ngraph::op::Broadcast*>(a.get());
-    const op::Broadcast* broadcast_b = static_cast<ngraph::op::Broadcast*>(b.get());
-
-    return (a->input(0).get_source_output() == b->input(0).get_source_output()) &&
-           (broadcast_a->get_broadcast_axes() == broadcast_b->get_broadcast_axes()) &&
-           (broadcast_a->get_broadcast_shape() == broadcast_b->get_broadcast_shape());
-}
-
 static bool cse_unarywise(shared_ptr<Node> a, shared_ptr<Node> b)
 {
     NGRAPH_DEBUG << "In cse_unarywise for " << a->get_name() << " and " << b->get_name();
@@ -132,16 +88,6 @@ static bool cse_unarywise(shared_ptr<Node> a, shared_ptr<Node> b)
     return a->input(0).get_source_output() == b->input(0).get_source_output();
 }
 
-static bool cse_binarywise(shared_ptr<Node> a, shared_ptr<Node> b)
-{
-    NGRAPH_DEBUG << "In cse_binary for " << a->get_name() << " and " << b->get_name();
-
-    return (a->input(0).get_source_output() == b->input(0).get_source_output() &&
-            a->input(1).get_source_output() == b->input(1).get_source_output()) ||
-           (a->input(1).get_source_output() == b->input(0).get_source_output() &&
-            a->input(0).get_source_output() == b->input(1).get_source_output());
-}
-
 static bool cse_reduction(shared_ptr<Node> a, shared_ptr<Node> b)
 {
     NGRAPH_DEBUG << "In cse_reduction for " << a->get_name() << " and " << b->get_name();
@@ -167,20 +113,13 @@ static bool cse_one_hot(shared_ptr<Node> a, shared_ptr<Node> b)
            (a->get_shape() == b->get_shape());
 }
 
+// Handlers for ops which do not expose their attributes through visit_attributes yet. Ops which
+// do are compared structurally by NodeKey.
 static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>
     initialize_ops_to_cse_handlers()
 {
     return unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>(
-        {{TI(op::Abs), cse_unarywise},
-         {TI(op::Acos), cse_unarywise},
-         {TI(op::Asin), cse_unarywise},
-         {TI(op::Atan), cse_unarywise},
-         {TI(op::Atan2), cse_binarywise},
-         {TI(op::Ceiling), cse_unarywise},
-         {TI(op::Constant), cse_constant},
-         {TI(op::Cos), cse_unarywise},
-         {TI(op::Cosh), cse_unarywise},
-         {TI(op::Exp), cse_unarywise},
+        {{TI(op::Exp), cse_unarywise},
          {TI(op::Floor), cse_unarywise},
          {TI(op::Log), cse_unarywise},
          {TI(op::Negative), cse_unarywise},
@@ -194,63 +133,216 @@ static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node
          {TI(op::Sqrt), cse_unarywise},
          {TI(op::Tan), cse_unarywise},
          {TI(op::Tanh), cse_unarywise},
-         {TI(op::Add), cse_binarywise},
-         {TI(op::Divide), cse_binarywise},
-         {TI(op::Maximum), cse_binarywise},
-         {TI(op::Minimum), cse_binarywise},
-         {TI(op::Multiply), cse_binarywise},
-         {TI(op::Power), cse_binarywise},
-         {TI(op::Subtract), cse_binarywise},
          {TI(op::Sum), cse_reduction},
          {TI(op::Product), cse_reduction},
-         {TI(op::Reshape), cse_reshape},
-         {TI(op::Broadcast), cse_broadcast}});
+         {TI(op::Reshape), cse_reshape}});
 }
 
 static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>
     ops_to_cse_handlers = initialize_ops_to_cse_handlers();
 
+/// \brief Serializes the attributes of a node into a byte string which is equal for two nodes
+///        exactly when their attributes are equal.
+class AttributeSignature : public AttributeVisitor
+{
+public:
+    const string& get_signature() const { return m_signature; }
+    /// \brief True if an attribute was visited which cannot be serialized
+    bool is_opaque() const { return m_opaque; }
+    void on_attribute(const string& name, string& value) override
+    {
+        append_name(name);
+        append_string(value);
+    }
+    void on_attribute(const string& name, bool& value) override
+    {
+        append_name(name);
+        m_signature.push_back(value ? 1 : 0);
+    }
+    void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+    {
+        append_name(name);
+        if (auto a = as_type<AttributeAdapter<element::Type>>(&adapter))
+        {
+            append_string(static_cast<element::Type&>(*a).c_type_string());
+        }
+        else if (auto a = as_type<AttributeAdapter<PartialShape>>(&adapter))
+        {
+            stringstream ss;
+            ss << static_cast<PartialShape&>(*a);
+            append_string(ss.str());
+        }
+        else if (auto a = as_type<AttributeAdapter<op::AutoBroadcastSpec>>(&adapter))
+        {
+            op::AutoBroadcastSpec& autob = *a;
+            append_bytes(&autob.m_type, sizeof(autob.m_type));
+            append_bytes(&autob.m_axis, sizeof(autob.m_axis));
+        }
+        else
+        {
+            m_opaque = true;
+        }
+    }
+    void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+    {
+        append_name(name);
+        append_string(adapter.get());
+    }
+    void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+    {
+        append_name(name);
+        const vector<int64_t>& value = adapter.get();
+        size_t size = value.size();
+        append_bytes(&size, sizeof(size));
+        append_bytes(value.data(), size * sizeof(int64_t));
+    }
+    void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+    {
+        append_name(name);
+        append_bytes(&adapter.get(), sizeof(int64_t));
+    }
+    void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+    {
+        append_name(name);
+        append_bytes(&adapter.get(), sizeof(double));
+    }
+
+private:
+    void append_bytes(const void* data, size_t size)
+    {
+        m_signature.append(static_cast<const char*>(data), size);
+    }
+    void append_string(const string& value)
+    {
+        size_t size = value.size();
+        append_bytes(&size, sizeof(size));
+        m_signature.append(value);
+    }
+    void append_name(const string& name) { append_string(name); }
+    string m_signature;
+    bool m_opaque{false};
+};
+
+/// \brief Structural identity of a node.
+///
+/// Two keys are equal when the nodes have the same type, the same input values, the same output
+/// element types and shapes, the same attributes and, for constants, the same data. Nodes which
+/// do not expose their attributes are compared with a handler, or never compared if there is
+/// none. The hash is computed once, so finding the duplicates of a function is linear.
 class NodeKey
 {
 public:
     NodeKey(const shared_ptr<Node>& n,
-            unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
+            const unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
                 backend_handlers)
         : m_node(n)
-        , m_node_ref(*n)
-        , m_ti(TI(m_node_ref))
-        , m_backend_handlers(backend_handlers)
+        , m_ti(TI(*n))
     {
-    }
+        for (auto input : n->inputs())
+        {
+            m_args.push_back(input.get_source_output());
+        }
+        if (n->is_commutative())
+        {
+            sort(begin(m_args), end(m_args));
+        }
 
-    shared_ptr<Node> get_node() const { return m_node; }
-    bool operator==(const NodeKey& other) const
-    {
-        if (m_ti == other.m_ti)
+        auto eh = backend_handlers.find(m_ti);
+        if (eh != backend_handlers.end())
+        {
+            m_handler = eh->second;
+        }
+        else if (auto constant = as_type_ptr<op::Constant>(n))
+        {
+            m_constant = constant;
+        }
+        else
         {
-            auto eh = ops_to_cse_handlers.find(m_ti);
-            if (eh != ops_to_cse_handlers.end())
+            AttributeSignature signature;
+            if (n->visit_attributes(signature) && !signature.is_opaque())
             {
-                return eh->second(m_node, other.m_node);
+                m_attributes = signature.get_signature();
             }
+            else
+            {
+                eh = ops_to_cse_handlers.find(m_ti);
+                if (eh == ops_to_cse_handlers.end())
+                {
+                    return;
+                }
+                m_handler = eh->second;
+            }
+        }
+        m_comparable = true;
 
-            eh = m_backend_handlers.find(m_ti);
-            if (eh != m_backend_handlers.end())
+        vector<size_t> ids{hash<type_index>{}(m_ti)};
+        for (auto& arg : m_args)
+        {
+            ids.push_back(arg.get_node()->get_instance_id());
+            ids.push_back(arg.get_index());
+        }
+        if (!m_handler)
+        {
+            for (auto& output : n->outputs())
             {
-                return eh->second(m_node, other.m_node);
+                ids.push_back(hash<string>{}(output.get_element_type().c_type_string()));
+                ids.push_back(hash_combine(output.get_shape()));
             }
+            ids.push_back(hash<string>{}(m_attributes));
+        }
+        if (m_constant)
+        {
+            ids.push_back(hash_bytes(m_constant->get_data_ptr(), get_data_size()));
         }
+        m_hash = hash_combine(ids);
+    }
 
-        return false;
+    shared_ptr<Node> get_node() const { return m_node; }
+    /// \brief False for nodes which cannot be compared, which are never equal to another node
+    bool is_comparable() const { return m_comparable; }
+    size_t get_hash() const { return m_hash; }
+    bool operator==(const NodeKey& other) const
+    {
+        if (!m_comparable || !other.m_comparable || m_hash != other.m_hash || m_ti != other.m_ti)
+        {
+            return false;
+        }
+        if (m_handler)
+        {
+            return m_handler(m_node, other.m_node);
+        }
+        if (m_args != other.m_args || m_attributes != other.m_attributes ||
+            m_node->get_output_size() != other.m_node->get_output_size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < m_node->get_output_size(); ++i)
+        {
+            if (m_node->get_output_element_type(i) != other.m_node->get_output_element_type(i) ||
+                m_node->get_output_shape(i) != other.m_node->get_output_shape(i))
+            {
+                return false;
+            }
+        }
+        return !m_constant || !memcmp(m_constant->get_data_ptr(),
+                                      other.m_constant->get_data_ptr(),
+                                      get_data_size());
     }
 
 private:
+    size_t get_data_size() const
+    {
+        return shape_size(m_constant->get_shape()) * m_constant->get_element_type().size();
+    }
+
     shared_ptr<Node> m_node;
-    // m_node_ref is only to allow getting the type_index in the ctor
-    Node& m_node_ref;
-    std::type_index m_ti;
-    unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
-        m_backend_handlers;
+    type_index m_ti;
+    vector<Output<Node>> m_args;
+    function<bool(shared_ptr<Node>, shared_ptr<Node>)> m_handler;
+    shared_ptr<op::Constant> m_constant;
+    string m_attributes;
+    bool m_comparable{false};
+    size_t m_hash{0};
 };
 
 namespace std
@@ -258,40 +350,7 @@ namespace std
     template <>
     struct hash<NodeKey>
     {
-        size_t operator()(const NodeKey& k) const
-        {
-            Node& p_this = *k.get_node().get();
-            auto ti = TI(p_this);
-
-            hash<type_index> type_hash_compute{};
-            auto type_hash = type_hash_compute(ti);
-
-            vector<size_t> arg_ids;
-
-            arg_ids.push_back(type_hash);
-
-            std::vector<Output<Node>> cargs;
-            for (auto input : k.get_node()->inputs())
-            {
-                cargs.push_back(input.get_source_output());
-            }
-
-            // TODO: Do we need another map, so we could
-            // specify how to compute hash for each op?
-            if (p_this.is_commutative())
-            {
-                sort(begin(cargs), end(cargs));
-            }
-
-            for (auto arg : cargs)
-            {
-                arg_ids.push_back(arg.get_node_shared_ptr()->get_instance_id());
-                arg_ids.push_back(arg.get_index());
-            }
-
-            auto hashc = ngraph::hash_combine(arg_ids);
-            return hashc;
-        }
+        size_t operator()(const NodeKey& k) const { return k.get_hash(); }
     };
 }
 
@@ -302,15 +361,23 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(shared_ptr<ng
 
     for (auto n : f->get_ordered_ops())
     {
-        if (n->is_output() || n->is_parameter())
+        // Stateful ops such as random ones produce different values each time and control
+        // dependencies order a node relative to others, so neither kind of node can be merged
+        if (n->is_output() || n->is_parameter() || n->has_state() ||
+            !n->get_control_dependencies().empty())
         {
             continue;
         }
 
         NodeKey n_key(n, m_backend_cse_handlers);
-        if (expressions.count(n_key))
+        if (!n_key.is_comparable())
+        {
+            continue;
+        }
+        auto it = expressions.find(n_key);
+        if (it != expressions.end())
         {
-            ngraph::replace_node(n, expressions.at(n_key));
+            ngraph::replace_node(n, it->second);
             replaced = true;
         }
         else
@@ -26,6 +26,12 @@ namespace ngraph
     }
 }
 
+/// \brief Replaces nodes which compute the same value as an earlier node with that node.
+///
+/// Nodes are hashed on their type, input values, output element types and shapes, the
+/// attributes they expose through visit_attributes and, for constants, their data. Ops which do
+/// not expose their attributes are compared by a handler for their type. Backends may supply
+/// handlers for their own ops, which take precedence.
 class NGRAPH_API ngraph::pass::CommonSubexpressionElimination : public FunctionPass
 {
 public:
@@ -15,14 +15,21 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
+#include <iomanip>
 #include <iostream>
+#include <map>
 #include <regex>
+#include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/op/label.hpp"
+#include "ngraph/pattern/op/or.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -60,6 +67,101 @@ using namespace ngraph;
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other
 //    fusion
+// Matchers are only tried on nodes whose type can match the root of their pattern. Nodes that
+// an earlier rewrite of the same pass has disconnected from the graph are skipped.
+
+namespace
+{
+    // Matchers are dispatched on the type of the root of their pattern. A pattern rooted at an
+    // op can only match a node of exactly that type (see Node::match_value), so nodes of any
+    // other type skip the matcher without calling into it. A Label wrapping a sub-pattern
+    // matches what the sub-pattern matches, and an Or matches what any of its alternatives
+    // matches. Other pattern ops, such as a Label without a sub-pattern or a Skip, can match
+    // anything and make the matcher a candidate for every node.
+    bool get_root_types(const Output<Node>& pattern, set<NodeTypeInfo>& types)
+    {
+        auto node = pattern.get_node();
+        if (!node->is_pattern())
+        {
+            types.insert(node->get_type_info());
+            return true;
+        }
+        if (is_type<pattern::op::Label>(node))
+        {
+            return get_root_types(node->input_value(0), types);
+        }
+        if (is_type<pattern::op::Or>(node))
+        {
+            for (auto& value : node->input_values())
+            {
+                if (!get_root_types(value, types))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    class MatcherIndex
+    {
+    public:
+        MatcherIndex(const vector<shared_ptr<pattern::Matcher>>& matchers)
+        {
+            for (auto& matcher : matchers)
+            {
+                set<NodeTypeInfo> types;
+                bool typed = get_root_types(matcher->get_pattern_value(), types);
+                m_root_types.push_back(typed ? types : set<NodeTypeInfo>{});
+                m_wildcard.push_back(!typed);
+            }
+        }
+
+        /// Indices of the matchers that may match a node of the given type, in registration
+        /// order.
+        const vector<size_t>& get_candidates(const NodeTypeInfo& type)
+        {
+            auto it = m_candidates.find(type);
+            if (it == m_candidates.end())
+            {
+                vector<size_t> candidates;
+                for (size_t i = 0; i < m_root_types.size(); i++)
+                {
+                    if (m_wildcard[i] || m_root_types[i].count(type) > 0)
+                    {
+                        candidates.push_back(i);
+                    }
+                }
+                it = m_candidates.insert(make_pair(type, move(candidates))).first;
+            }
+            return it->second;
+        }
+
+    private:
+        vector<set<NodeTypeInfo>> m_root_types;
+        vector<bool> m_wildcard;
+        map<NodeTypeInfo, vector<size_t>> m_candidates;
+    };
+
+    // True if an earlier rewrite disconnected the node from the graph. Such a node is still in
+    // the ordered op list of the sweep but can no longer contribute to the function.
+    bool is_orphaned(const Node& node)
+    {
+        if (node.is_output() || node.is_parameter() || !node.get_control_dependents().empty())
+        {
+            return false;
+        }
+        for (auto& output : node.outputs())
+        {
+            if (!output.get_target_inputs().empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
 
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
@@ -70,7 +172,10 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     // This check is very expensive and is only needed for experimental features, so we will hide
     // it behind an environment variable for now. TODO: Find a less expensive way to handle this.
     static bool s_rerun_dynamic_check = getenv_bool("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK");
+    static bool s_profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
     bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+    m_matcher_statistics.clear();
+    unordered_map<pattern::Matcher*, size_t> statistics_index;
     do
     {
         rewritten = false;
@@ -78,14 +183,34 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
+        vector<shared_ptr<pattern::Matcher>> matchers;
+        vector<size_t> statistics;
+        for (auto& closure : matchers_to_run)
+        {
+            matchers.push_back(closure.matcher);
+            if (statistics_index.count(closure.matcher.get()) == 0)
+            {
+                statistics_index[closure.matcher.get()] = m_matcher_statistics.size();
+                m_matcher_statistics.emplace_back();
+                m_matcher_statistics.back().name = closure.matcher->get_name();
+            }
+            statistics.push_back(statistics_index[closure.matcher.get()]);
+        }
+        MatcherIndex index(matchers);
         for (auto node : f->get_ordered_ops())
         {
             if (m_enable_shape_inference)
             {
                 node->revalidate_and_infer_types();
             }
-            for (auto& closure : matchers_to_run)
+            auto& candidates = index.get_candidates(node->get_type_info());
+            if (candidates.empty() || (rewritten && is_orphaned(*node)))
+            {
+                continue;
+            }
+            for (size_t i : candidates)
             {
+                auto& closure = matchers_to_run[i];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -97,28 +222,48 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                 NGRAPH_DEBUG << "Running matcher " << closure.matcher->get_name() << "("
                              << closure.matcher->get_pattern()->get_name() << ") on "
                              << node->get_name();
+                MatcherStatistics& stats = m_matcher_statistics[statistics[i]];
+                auto start = chrono::steady_clock::now();
+                stats.attempts++;
+                bool done = false;
                 if (closure.matcher->match(node))
                 {
                     NGRAPH_DEBUG << "Matcher " << closure.matcher << closure.matcher->get_name()
                                  << " matched " << node->get_name();
+                    stats.matches++;
                     if (closure.callback(*closure.matcher.get()))
                     {
+                        stats.rewrites++;
                         rewritten = true;
+                        done = true;
                         // If call back may change function's is_dynamic state, we need to
                         // update the cached value.
                         if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
                         {
                             is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
                         }
-                        break;
                     }
                 }
+                stats.time += chrono::steady_clock::now() - start;
+                if (done)
+                {
+                    break;
+                }
             }
         }
 
     } while (rewritten && m_matchers.size() > 0 && tries--);
 
     m_matchers.assign(original_matchers.begin(), original_matchers.end());
+    if (s_profile_enabled)
+    {
+        for (auto& stats : m_matcher_statistics)
+        {
+            cout << setw(7) << chrono::duration_cast<chrono::milliseconds>(stats.time).count()
+                 << "ms   " << stats.name << ": " << stats.rewrites << " rewrites, "
+                 << stats.matches << " matches, " << stats.attempts << " attempts\n";
+        }
+    }
     return (NUM_TRIES - tries) > 1; // this means a graph was transformed
 }
 
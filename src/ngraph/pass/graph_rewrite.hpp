@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -68,6 +71,25 @@ public:
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    /// \brief Counters for one matcher, collected by the last run_on_function call.
+    struct MatcherStatistics
+    {
+        std::string name;
+        /// Number of nodes the matcher was tried on
+        size_t attempts = 0;
+        /// Number of nodes the pattern matched
+        size_t matches = 0;
+        /// Number of matches for which the callback rewrote the graph
+        size_t rewrites = 0;
+        /// Time spent matching and in the callback
+        std::chrono::nanoseconds time{0};
+    };
+    /// \brief Returns the matcher counters of the last run, in registration order.
+    const std::vector<MatcherStatistics>& get_matcher_statistics() const
+    {
+        return m_matcher_statistics;
+    }
+
 protected:
     bool is_enabled(const std::shared_ptr<pattern::Matcher>& m) const;
     bool m_enable_shape_inference = false;
@@ -80,6 +102,7 @@ private:
         PassPropertyMask property;
     };
     std::vector<MatchClosure> m_matchers;
+    std::vector<MatcherStatistics> m_matcher_statistics;
 };
 
 class NGRAPH_API ngraph::pass::RecurrentGraphRewrite : public FunctionPass
@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/in_place_elementwise.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/not.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/op/select.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool is_elementwise(const Node& node)
+{
+    return node.is_unary_elementwise_arithmetic() || node.is_binary_elementwise_arithmetic() ||
+           node.is_binary_elementwise_comparison() || node.is_binary_elementwise_logical() ||
+           is_type<op::Not>(&node) || is_type<op::v0::Select>(&node) ||
+           is_type<op::v1::Select>(&node);
+}
+
+static bool is_last_use(const Input<Node>& input)
+{
+    Node* node = input.get_node();
+    descriptor::Tensor* tensor = &input.get_tensor();
+    if (node->liveness_free_list.count(tensor) != 0)
+    {
+        return true;
+    }
+    Output<Node> source = input.get_source_output();
+    return source.get_target_inputs().size() == 1 && !source.get_node()->is_parameter() &&
+           !source.get_node()->is_constant();
+}
+
+bool pass::InPlaceElementwise::run_on_function(shared_ptr<Function> function)
+{
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (!node->is_op() || node->get_output_size() != 1 || !is_elementwise(*node))
+        {
+            continue;
+        }
+        auto op = static_pointer_cast<op::Op>(node);
+        auto op_annotations = op->get_op_annotations();
+        if (op_annotations && !op_annotations->get_in_place_oi_pairs().empty())
+        {
+            continue;
+        }
+        Output<Node> output = node->output(0);
+        if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic())
+        {
+            continue;
+        }
+        for (auto input : node->inputs())
+        {
+            if (input.get_element_type() == output.get_element_type() &&
+                input.get_partial_shape().is_static() &&
+                input.get_shape() == output.get_shape() && is_last_use(input))
+            {
+                if (!op_annotations)
+                {
+                    op_annotations = op_annotations_factory();
+                    op->set_op_annotations(op_annotations);
+                }
+                NGRAPH_DEBUG << "in-place elementwise: " << node->get_name() << " overwrites "
+                             << input.get_tensor().get_name();
+                op_annotations->add_in_place_oi_pair({0, input.get_index(), true});
+                break;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "ngraph/op/util/op_annotations.hpp"
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class InPlaceElementwise;
+    }
+}
+
+/// \brief Lets elementwise ops overwrite an input which dies at that op.
+///
+/// Every unary and binary elementwise op, Not and Select without an in-place hint gets a
+/// destructive oi pair between its output and the first input of the same element type and
+/// shape which is last used there. An input is last used at the op if it is in the op's
+/// liveness free list, so run \sa Liveness first where available, or if the op is its only
+/// consumer. Memory assignment still checks the pair before sharing the buffer.
+///
+/// Only valid for backends whose elementwise kernels compute each output element from the
+/// same element of the inputs, which holds for the reference kernels.
+class NGRAPH_API ngraph::pass::InPlaceElementwise : public FunctionPass
+{
+public:
+    InPlaceElementwise()
+        : FunctionPass()
+    {
+    }
+
+    InPlaceElementwise(std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)> func)
+        : FunctionPass()
+        , op_annotations_factory(func)
+    {
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)> op_annotations_factory =
+        []() -> std::shared_ptr<ngraph::op::util::OpAnnotations> {
+        return std::make_shared<ngraph::op::util::OpAnnotations>();
+    };
+};
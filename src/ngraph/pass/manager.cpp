@@ -18,15 +18,20 @@
 #ifdef _WIN32
 #else
 #include <cxxabi.h>
+#include <sys/resource.h>
 #endif
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <sstream>
 
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
@@ -39,8 +44,42 @@ using namespace ngraph;
 pass::Manager::Manager()
     : m_visualize(getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING"))
     , m_serialize(getenv_bool("NGRAPH_ENABLE_SERIALIZE_TRACING"))
+    , m_profile(getenv_bool("NGRAPH_PROFILE_PASS_ENABLE"))
+{
+}
+
+static string get_pass_name(const pass::PassBase& pass)
+{
+    string name = typeid(pass).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled != nullptr)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
 
+static size_t get_peak_rss()
 {
+#ifdef _WIN32
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss;
+#else
+    // Linux reports kilobytes
+    return usage.ru_maxrss * 1024;
+#endif
+#endif
 }
 
 pass::Manager::~Manager()
@@ -58,9 +97,22 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
     size_t index = 0;
     stopwatch pass_timer;
     stopwatch overall_timer;
+    bool profile = m_profile || runtime::event::Manager::is_tracing_enabled();
+    size_t node_count = profile ? func->get_ordered_ops().size() : 0;
+    m_pass_profiles.clear();
     overall_timer.start();
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        PassProfile pass_profile;
+        // Nodes constructed from here on have at least this instance id
+        size_t first_new_instance_id = 0;
+        if (profile)
+        {
+            pass_profile.name = get_pass_name(*pass);
+            pass_profile.node_count_before = node_count;
+            first_new_instance_id = Node::get_instance_count();
+        }
+        runtime::event::Duration event(pass_profile.name, "Pass");
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -154,15 +206,43 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
         }
         index++;
         pass_timer.stop();
-        if (profile_enabled)
+        if (profile)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            pass_profile.time = pass_timer.get_timer_value();
+            // Only nodes that ended up in the function count, so nodes other threads construct
+            // meanwhile and nodes the pass discarded are left out
+            auto ops = func->get_ordered_ops();
+            for (const shared_ptr<Node>& op : ops)
+            {
+                if (op->get_instance_id() >= first_new_instance_id)
+                {
+                    pass_profile.nodes_created++;
+                }
+            }
+            node_count = ops.size();
+            pass_profile.node_count_after = node_count;
+            if (auto graph_rewrite = dynamic_pointer_cast<GraphRewrite>(pass))
+            {
+                for (auto& statistics : graph_rewrite->get_matcher_statistics())
+                {
+                    pass_profile.rewrites += statistics.rewrites;
+                }
+            }
+            pass_profile.peak_rss = get_peak_rss();
+
+            stringstream args;
+            args << R"({"node_count_before":)" << pass_profile.node_count_before
+                 << R"(,"node_count_after":)" << pass_profile.node_count_after
+                 << R"(,"nodes_created":)" << pass_profile.nodes_created << R"(,"rewrites":)"
+                 << pass_profile.rewrites << R"(,"peak_rss":)" << pass_profile.peak_rss << "}";
+            event.set_args(args.str());
+            m_pass_profiles.push_back(pass_profile);
+        }
+        if (profile_enabled && profile)
+        {
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass_profile.name << " ("
+                 << pass_profile.node_count_before << " -> " << pass_profile.node_count_after
+                 << " ops)\n";
         }
     }
     if (profile_enabled)
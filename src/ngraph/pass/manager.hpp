@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -32,9 +34,28 @@ namespace ngraph
     {
         class Manager;
         class ManagerState;
+        struct PassProfile;
     }
 }
 
+/// \brief Measurements of one pass of a \sa Manager::run_passes call
+struct NGRAPH_API ngraph::pass::PassProfile
+{
+    /// The demangled class name of the pass
+    std::string name;
+    /// Wall time of the pass
+    std::chrono::nanoseconds time{0};
+    /// Number of ops in the function before and after the pass
+    size_t node_count_before = 0;
+    size_t node_count_after = 0;
+    /// Number of ops in the function after the pass that were constructed while it ran
+    size_t nodes_created = 0;
+    /// Number of successful rewrites for GraphRewrite passes, zero for other passes
+    size_t rewrites = 0;
+    /// Peak resident set size of the process in bytes after the pass, zero where unsupported
+    size_t peak_rss = 0;
+};
+
 class NGRAPH_API ngraph::pass::Manager
 {
 public:
@@ -60,6 +81,15 @@ public:
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
     void set_per_pass_validation(bool new_state) { m_per_pass_validation = new_state; }
+    /// \brief Enables collecting a \sa PassProfile for every pass run by run_passes.
+    ///
+    /// Profiling is enabled by default if NGRAPH_PROFILE_PASS_ENABLE is set. When event
+    /// tracing is enabled, see \sa runtime::event::Manager, every pass is also written to the
+    /// trace as a duration event with the profile as its arguments.
+    void set_pass_profiling(bool new_state) { m_profile = new_state; }
+    /// \brief Returns the profiles of the passes of the last run_passes call, in order.
+    const std::vector<PassProfile>& get_pass_profiles() const { return m_pass_profiles; }
+
 private:
     template <typename T, class... Args>
     std::shared_ptr<T> push_pass(Args&&... args)
@@ -91,4 +121,6 @@ private:
     bool m_visualize = false;
     bool m_serialize = false;
     bool m_per_pass_validation = true;
+    bool m_profile = false;
+    std::vector<PassProfile> m_pass_profiles;
 };
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
 #include <sstream>
 
@@ -30,9 +31,12 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 bool offline_planning)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_offline_planning(offline_planning)
 {
     if (m_alignment == 0)
     {
@@ -42,7 +46,17 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
-    MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    MemoryManager::allocation_scheme scheme = MemoryManager::allocation_scheme::FIRST_FIT;
+    if (m_disable_memory_sharing)
+    {
+        scheme = MemoryManager::allocation_scheme::NO_REUSE;
+    }
+    else if (m_offline_planning)
+    {
+        scheme = MemoryManager::allocation_scheme::OFFLINE;
+    }
+    MemoryManager mm(m_alignment, scheme);
+    vector<descriptor::Tensor*> allocated_tensors;
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
@@ -87,6 +101,7 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
                                 ? in_place_outputs.at(tensor)->get_pool_offset()
                                 : mm.allocate(tensor->size());
             tensor->set_pool_offset(offset);
+            allocated_tensors.push_back(tensor);
         }
 
         if (!m_disable_memory_sharing)
@@ -100,6 +115,15 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
             }
         }
     }
+    if (scheme == MemoryManager::allocation_scheme::OFFLINE)
+    {
+        for (descriptor::Tensor* tensor : allocated_tensors)
+        {
+            tensor->set_pool_offset(mm.get_planned_offset(tensor->get_pool_offset()));
+        }
+        NGRAPH_DEBUG << "MemoryLayout: offline plan uses " << mm.max_allocated()
+                     << " bytes, lower bound " << mm.get_lower_bound();
+    }
     function->set_temporary_pool_size(mm.max_allocated());
 
     return false;
@@ -123,6 +147,18 @@ pass::MemoryManager::MemoryManager(size_t alignment, bool disable_memory_reuse)
     m_node_list.emplace_back(numeric_limits<size_t>::max(), block_state::FREE);
 }
 
+pass::MemoryManager::MemoryManager(size_t alignment, allocation_scheme scheme)
+    : m_alignment{alignment}
+    , m_scheme{scheme}
+    , m_max_allocated{0}
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+    m_node_list.emplace_back(numeric_limits<size_t>::max(), block_state::FREE);
+}
+
 size_t pass::MemoryManager::allocate(size_t size)
 {
     size_t rc = 0;
@@ -131,10 +167,151 @@ size_t pass::MemoryManager::allocate(size_t size)
     case allocation_scheme::FIRST_FIT: rc = first_fit(size); break;
     case allocation_scheme::BEST_FIT: rc = best_fit(size); break;
     case allocation_scheme::NO_REUSE: rc = no_reuse_allocator(size); break;
+    case allocation_scheme::OFFLINE: rc = offline_allocator(size); break;
     }
     return rc;
 }
 
+size_t pass::MemoryManager::offline_allocator(size_t size)
+{
+    // Placeholders only have to be unique, the real offsets are assigned by plan()
+    size = align(size, m_alignment);
+    size_t placeholder = m_placeholder_end;
+    m_placeholder_end += size;
+    m_placeholder_buffers[placeholder] = m_buffers.size();
+    m_buffers.push_back(buffer{size, m_event_count++, numeric_limits<size_t>::max()});
+    m_planned = false;
+    return placeholder;
+}
+
+void pass::MemoryManager::offline_free(size_t offset)
+{
+    auto it = m_placeholder_buffers.find(offset);
+    if (it == m_placeholder_buffers.end() ||
+        m_buffers[it->second].freed != numeric_limits<size_t>::max())
+    {
+        throw runtime_error("bad free");
+    }
+    m_buffers[it->second].freed = m_event_count++;
+    m_planned = false;
+}
+
+void pass::MemoryManager::plan() const
+{
+    if (m_planned)
+    {
+        return;
+    }
+
+    // Greedy by size: place the largest buffers first, each at the lowest offset of the
+    // smallest gap between the already placed buffers whose lifetimes overlap it.
+    vector<size_t> order(m_buffers.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+    stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return m_buffers[a].size > m_buffers[b].size;
+    });
+
+    // Placed buffers, kept sorted by offset
+    vector<size_t> placed;
+    m_planned_offsets.assign(m_buffers.size(), 0);
+    m_max_allocated = 0;
+    for (size_t index : order)
+    {
+        const buffer& current = m_buffers[index];
+        size_t best_offset = numeric_limits<size_t>::max();
+        size_t best_gap = numeric_limits<size_t>::max();
+        size_t prev_end = 0;
+        for (size_t other_index : placed)
+        {
+            const buffer& other = m_buffers[other_index];
+            if (other.allocated >= current.freed || current.allocated >= other.freed)
+            {
+                continue;
+            }
+            size_t other_offset = m_planned_offsets[other_index];
+            if (other_offset >= prev_end)
+            {
+                size_t gap = other_offset - prev_end;
+                if (gap >= current.size && gap < best_gap)
+                {
+                    best_gap = gap;
+                    best_offset = prev_end;
+                }
+            }
+            prev_end = max(prev_end, other_offset + other.size);
+        }
+        if (best_offset == numeric_limits<size_t>::max())
+        {
+            best_offset = prev_end;
+        }
+        m_planned_offsets[index] = best_offset;
+        m_max_allocated = max(m_max_allocated, best_offset + current.size);
+
+        auto pos = upper_bound(
+            placed.begin(), placed.end(), best_offset, [this](size_t o, size_t i) {
+                return o < m_planned_offsets[i];
+            });
+        placed.insert(pos, index);
+    }
+
+    // Sweep the allocation and free events to find the peak of live memory
+    vector<pair<size_t, long long>> events;
+    for (const buffer& b : m_buffers)
+    {
+        events.push_back({b.allocated, static_cast<long long>(b.size)});
+        if (b.freed != numeric_limits<size_t>::max())
+        {
+            events.push_back({b.freed, -static_cast<long long>(b.size)});
+        }
+    }
+    sort(events.begin(), events.end());
+    long long live = 0;
+    m_lower_bound = 0;
+    for (auto& event : events)
+    {
+        live += event.second;
+        m_lower_bound = max(m_lower_bound, static_cast<size_t>(live));
+    }
+    m_planned = true;
+}
+
+size_t pass::MemoryManager::get_planned_offset(size_t offset) const
+{
+    if (m_scheme != allocation_scheme::OFFLINE)
+    {
+        return offset;
+    }
+    auto it = m_placeholder_buffers.find(offset);
+    if (it == m_placeholder_buffers.end())
+    {
+        throw runtime_error("unknown allocation");
+    }
+    plan();
+    return m_planned_offsets[it->second];
+}
+
+size_t pass::MemoryManager::get_lower_bound() const
+{
+    if (m_scheme != allocation_scheme::OFFLINE)
+    {
+        return m_max_allocated;
+    }
+    plan();
+    return m_lower_bound;
+}
+
+size_t pass::MemoryManager::max_allocated() const
+{
+    if (m_scheme == allocation_scheme::OFFLINE)
+    {
+        plan();
+    }
+    return m_max_allocated;
+}
+
 size_t pass::MemoryManager::no_reuse_allocator(size_t size)
 {
     size_t offset = m_max_allocated;
@@ -220,6 +397,11 @@ size_t pass::MemoryManager::first_fit(size_t size)
 
 void pass::MemoryManager::free(size_t offset)
 {
+    if (m_scheme == allocation_scheme::OFFLINE)
+    {
+        offline_free(offset);
+        return;
+    }
     size_t search_offset = 0;
     bool found = false;
     for (auto it = m_node_list.begin(); it != m_node_list.end(); ++it)
@@ -19,6 +19,8 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <unordered_map>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -35,12 +37,19 @@ namespace ngraph
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    /// \param alignment Alignment of every tensor in the pool
+    /// \param disable_memory_sharing Give every tensor its own memory
+    /// \param offline_planning Place tensors with \sa MemoryManager::allocation_scheme::OFFLINE
+    ///        instead of first fit
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 bool offline_planning = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
 private:
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    bool m_offline_planning;
 };
 
 class ngraph::pass::MemoryManager
@@ -56,7 +65,11 @@ public:
     {
         FIRST_FIT,
         BEST_FIT,
-        NO_REUSE
+        NO_REUSE,
+        /// Records the lifetime of every allocation and places them all at once, largest first,
+        /// each in the smallest gap left by the allocations it is live with. allocate returns
+        /// a placeholder offset that get_planned_offset maps to the final offset.
+        OFFLINE
     };
 
     class node
@@ -70,11 +83,20 @@ public:
     };
 
     MemoryManager(size_t alignment = 1, bool disable_reuse = false);
+    MemoryManager(size_t alignment, allocation_scheme scheme);
     // memory_manager& alignment(size_t a);
 
     size_t allocate(size_t size);
     void free(size_t offset);
 
+    /// \brief Returns the final offset of the allocation at `offset`, as returned by allocate.
+    ///        Only OFFLINE returns placeholder offsets, other schemes return `offset`.
+    size_t get_planned_offset(size_t offset) const;
+    /// \brief Returns the largest total size of the allocations live at the same time, which
+    ///        no placement can improve on. Lifetimes are only recorded by OFFLINE, other
+    ///        schemes return max_allocated().
+    size_t get_lower_bound() const;
+
     void dump(std::ostream&);
 
     static size_t align(size_t x, size_t alignment);
@@ -84,14 +106,37 @@ public:
     std::list<node>::const_iterator begin() const { return m_node_list.cbegin(); }
     std::list<node>::const_iterator end() const { return m_node_list.cend(); }
     const std::list<node>& get_node_list() const { return m_node_list; }
-    size_t max_allocated() const { return m_max_allocated; }
+    size_t max_allocated() const;
+
 private:
     size_t first_fit(size_t size);
     size_t best_fit(size_t size);
     size_t no_reuse_allocator(size_t size);
+    size_t offline_allocator(size_t size);
+    void offline_free(size_t offset);
+    void plan() const;
+
+    struct buffer
+    {
+        size_t size;
+        size_t allocated;
+        size_t freed;
+    };
 
     std::list<node> m_node_list;
     size_t m_alignment;
     allocation_scheme m_scheme;
-    size_t m_max_allocated;
+    // Also set by plan()
+    mutable size_t m_max_allocated;
+
+    // OFFLINE state. Allocations and frees are numbered in the order they happen, two
+    // allocations overlap in time if either is allocated while the other is live.
+    std::vector<buffer> m_buffers;
+    std::unordered_map<size_t, size_t> m_placeholder_buffers;
+    size_t m_placeholder_end = 0;
+    size_t m_event_count = 0;
+    // Placement of m_buffers, computed lazily by plan()
+    mutable std::vector<size_t> m_planned_offsets;
+    mutable size_t m_lower_bound = 0;
+    mutable bool m_planned = true;
 };
@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/share_constants.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/constant_store.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool pass::ShareConstants::run_on_function(shared_ptr<Function> f)
+{
+    bool replaced = false;
+    auto& store = runtime::ConstantStore::get();
+    for (auto node : f->get_ordered_ops())
+    {
+        // Subclasses such as ScalarConstantLike have inputs and no data of their own
+        if (node->get_type_info() != op::Constant::type_info)
+        {
+            continue;
+        }
+        auto constant = static_pointer_cast<op::Constant>(node);
+        auto data = constant->get_data();
+        if (!data || constant->get_users().empty())
+        {
+            continue;
+        }
+        size_t size = shape_size(constant->get_shape()) * constant->get_element_type().size();
+        auto shared_data = store.intern(data, size);
+        if (shared_data != data)
+        {
+            auto shared_constant = make_shared<op::Constant>(
+                constant->get_element_type(), constant->get_shape(), shared_data);
+            shared_constant->set_friendly_name(constant->get_friendly_name());
+            replace_node(constant, shared_constant);
+            replaced = true;
+        }
+    }
+    return replaced;
+}
@@ -0,0 +1,39 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class ShareConstants;
+    }
+}
+
+/// \brief Makes every Constant use the buffer of the process wide \sa runtime::ConstantStore
+///        for its content.
+///
+/// Clones of a function already share the data of their constants. This pass also shares the
+/// data of constants created independently, such as the weights of a model deserialized or
+/// constant folded once per executable, so the process keeps one copy of each weight.
+class NGRAPH_API ngraph::pass::ShareConstants : public FunctionPass
+{
+public:
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
@@ -0,0 +1,200 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/pass/subgraph_constant_folding.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// An op can be folded if it is deterministic, its outputs are static and all of its inputs are
+// constant or foldable. Control dependencies are left alone.
+static bool is_foldable(const Node& node, const unordered_map<const Node*, size_t>& foldable)
+{
+    if (!node.is_op() || node.is_parameter() || node.is_constant() || node.is_output() ||
+        node.get_input_size() == 0 || node.has_state() ||
+        !node.get_control_dependencies().empty() || !node.get_control_dependents().empty())
+    {
+        return false;
+    }
+    for (auto& output : node.outputs())
+    {
+        if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic())
+        {
+            return false;
+        }
+    }
+    for (auto& input : node.inputs())
+    {
+        const Node* source = input.get_source_output().get_node();
+        if (!source->is_constant() && foldable.count(source) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static size_t find_subgraph(vector<size_t>& parents, size_t subgraph)
+{
+    while (parents[subgraph] != subgraph)
+    {
+        parents[subgraph] = parents[parents[subgraph]];
+        subgraph = parents[subgraph];
+    }
+    return subgraph;
+}
+
+bool pass::SubgraphConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    // Number the foldable ops and join the subgraphs of ops connected through a foldable op.
+    // Constants do not join subgraphs since they are not evaluated.
+    auto ops = f->get_ordered_ops();
+    unordered_map<const Node*, size_t> foldable;
+    vector<size_t> parents;
+    for (auto& node : ops)
+    {
+        if (!is_foldable(*node, foldable))
+        {
+            continue;
+        }
+        size_t subgraph = parents.size();
+        parents.push_back(subgraph);
+        for (auto& input : node->inputs())
+        {
+            auto it = foldable.find(input.get_source_output().get_node());
+            if (it != foldable.end())
+            {
+                parents[find_subgraph(parents, it->second)] = subgraph;
+            }
+        }
+        foldable[node.get()] = subgraph;
+    }
+
+    // Outputs of a subgraph are the outputs of foldable ops used by the rest of the graph
+    map<size_t, vector<Output<Node>>> subgraph_outputs;
+    map<size_t, vector<shared_ptr<Node>>> subgraph_nodes;
+    for (auto& node : ops)
+    {
+        auto it = foldable.find(node.get());
+        if (it == foldable.end())
+        {
+            continue;
+        }
+        size_t subgraph = find_subgraph(parents, it->second);
+        for (auto& output : node->outputs())
+        {
+            bool used_outside = false;
+            for (auto& target : output.get_target_inputs())
+            {
+                if (foldable.count(target.get_node()) == 0)
+                {
+                    used_outside = true;
+                    break;
+                }
+            }
+            size_t size = shape_size(output.get_shape()) * output.get_element_type().size();
+            if (used_outside && size != 0 && size <= m_max_constant_size)
+            {
+                subgraph_outputs[subgraph].push_back(output);
+            }
+        }
+    }
+    if (subgraph_outputs.empty())
+    {
+        return false;
+    }
+
+    shared_ptr<runtime::Backend> backend;
+    try
+    {
+        backend = runtime::Backend::create(m_backend_name);
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_DEBUG << "SubgraphConstantFolding: backend " << m_backend_name
+                     << " is not available: " << e.what();
+        return false;
+    }
+
+    bool replaced = false;
+    for (auto& item : subgraph_outputs)
+    {
+        vector<Output<Node>>& outputs = item.second;
+
+        // Evaluate a copy of the subgraph so the function is untouched if the backend fails
+        NodeVector roots;
+        for (auto& output : outputs)
+        {
+            roots.push_back(output.get_node_shared_ptr());
+        }
+        NodeMap node_map;
+        clone_nodes(roots, node_map);
+        ResultVector results;
+        for (auto& output : outputs)
+        {
+            results.push_back(make_shared<op::Result>(
+                Output<Node>(node_map.at(output.get_node()), output.get_index())));
+        }
+        auto subgraph = make_shared<Function>(results, ParameterVector{});
+
+        vector<shared_ptr<runtime::AlignedBuffer>> buffers;
+        try
+        {
+            vector<shared_ptr<runtime::Tensor>> result_tensors;
+            for (auto& output : outputs)
+            {
+                size_t size = shape_size(output.get_shape()) * output.get_element_type().size();
+                buffers.push_back(make_shared<runtime::AlignedBuffer>(size));
+                result_tensors.push_back(backend->create_tensor(
+                    output.get_element_type(), output.get_shape(), buffers.back()->get_ptr()));
+            }
+            auto executable = backend->compile(subgraph);
+            executable->call(result_tensors, {});
+        }
+        catch (const exception& e)
+        {
+            NGRAPH_DEBUG << "SubgraphConstantFolding: could not evaluate subgraph of "
+                         << outputs.size() << " outputs: " << e.what();
+            continue;
+        }
+
+        for (size_t i = 0; i < outputs.size(); ++i)
+        {
+            auto constant = make_shared<op::Constant>(
+                outputs[i].get_element_type(), outputs[i].get_shape(), buffers[i]);
+            auto node = outputs[i].get_node_shared_ptr();
+            if (node->get_output_size() == 1)
+            {
+                replace_node(node, constant);
+            }
+            else
+            {
+                outputs[i].replace(constant->output(0));
+            }
+        }
+        replaced = true;
+    }
+    return replaced;
+}
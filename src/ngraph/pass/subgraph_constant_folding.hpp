@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <string>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class SubgraphConstantFolding;
+    }
+}
+
+/// \brief Folds every op whose value only depends on constants by executing it on a backend.
+///
+/// Unlike \sa ConstantFolding this needs no folder per op. The ops computable from constants
+/// are split into connected subgraphs, each subgraph is compiled and executed once on the
+/// backend, and every output it feeds to the rest of the graph is replaced by a Constant.
+/// Outputs larger than the size cap are left in the graph so that folding a Broadcast or Tile
+/// does not bloat the model. Subgraphs the backend fails to execute are left as they are.
+class NGRAPH_API ngraph::pass::SubgraphConstantFolding : public FunctionPass
+{
+public:
+    /// \param backend_name Backend to evaluate the subgraphs on
+    /// \param max_constant_size Largest folded constant in bytes
+    SubgraphConstantFolding(const std::string& backend_name = "INTERPRETER",
+                            size_t max_constant_size = 16 * 1024 * 1024)
+        : FunctionPass()
+        , m_backend_name(backend_name)
+        , m_max_constant_size(max_constant_size)
+    {
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    std::string m_backend_name;
+    size_t m_max_constant_size;
+};
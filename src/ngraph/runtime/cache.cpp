@@ -14,26 +14,21 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <sstream>
+
+#include "ngraph/env_util.hpp"
 #include "ngraph/runtime/cache.hpp"
+#include "ngraph/util.hpp"
 
 using namespace ngraph;
 using namespace std;
 
 // Constructor
 runtime::LRUCache::LRUCache()
+    : m_max_bytes{0}
 {
-    char* cache_size = getenv("NGRAPH_CACHE_SIZE");
-    if (cache_size == nullptr)
-    {
-        m_cache_size = 1024; // TODO(nbpatel): Figure out a default size for the cache
-    }
-    else
-    {
-        m_cache_size = atoi(cache_size);
-    }
-
-    m_map = {};
-    m_list = {};
+    int32_t cache_size = getenv_int("NGRAPH_CACHE_SIZE");
+    m_max_entries = cache_size < 0 ? 1024 : cache_size;
 }
 
 // Destructor
@@ -41,90 +36,112 @@ runtime::LRUCache::~LRUCache()
 {
     m_list.clear();
     m_map.clear();
-    m_clone_function_map.clear();
 }
 
-void runtime::LRUCache::convert_shape_to_string(const vector<int>& shape, ostringstream& key)
+size_t runtime::LRUCache::KeyHash::operator()(const Key& key) const
 {
-    if (!shape.empty())
+    vector<size_t> hashes;
+    for (int64_t value : key)
     {
-        std::copy(shape.begin(), shape.end(), std::ostream_iterator<int>(key, ", "));
+        hashes.push_back(hash<int64_t>()(value));
     }
+    return hash_combine(hashes);
 }
 
-void runtime::LRUCache::add_entry(const vector<int>& shape,
+string runtime::LRUCache::key_to_string(const Key& key)
+{
+    ostringstream ss;
+    for (int64_t value : key)
+    {
+        ss << value << ", ";
+    }
+    return ss.str();
+}
+
+void runtime::LRUCache::add_entry(const Key& key,
                                   shared_ptr<runtime::Executable> exec,
-                                  shared_ptr<Function> func)
+                                  size_t byte_size)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    // check if the list is empty
-    if (m_list.size() == m_cache_size)
+    auto it = m_map.find(key);
+    if (it != m_map.end())
     {
-        ostringstream key;
-        convert_shape_to_string(m_list.back(), key);
-        m_list.pop_back();
-        m_map.erase(key.str());
+        m_statistics.bytes -= it->second.m_byte_size;
+        m_list.erase(it->second.m_position);
+        m_map.erase(it);
     }
 
-    convert_shape_to_string(shape, key);
-    m_map.insert({key.str(), exec});
-    m_list.push_front(shape);
-    m_clone_function_map.insert({key.str(), func});
+    m_list.push_front(key);
+    m_map.insert({key, Entry{exec, byte_size, m_list.begin()}});
+    m_statistics.bytes += byte_size;
+    evict();
 }
 
-bool runtime::LRUCache::is_cached(const vector<int>& shape)
+void runtime::LRUCache::evict()
 {
-    for (auto itr = m_list.begin(); itr != m_list.end(); itr++)
+    // The most recently added entry is never evicted, even if it alone exceeds the limits
+    while (m_list.size() > 1 && ((m_max_entries > 0 && m_list.size() > m_max_entries) ||
+                                 (m_max_bytes > 0 && m_statistics.bytes > m_max_bytes)))
     {
-        if (*itr == shape)
-        {
-            return true;
-        }
+        auto it = m_map.find(m_list.back());
+        m_statistics.bytes -= it->second.m_byte_size;
+        m_statistics.evictions++;
+        m_map.erase(it);
+        m_list.pop_back();
     }
-    return false;
+    m_statistics.entries = m_list.size();
 }
 
-shared_ptr<runtime::Executable> runtime::LRUCache::get_cached_entry(const vector<int>& shape)
+bool runtime::LRUCache::is_cached(const Key& key)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    convert_shape_to_string(shape, key);
+    return m_map.find(key) != m_map.end();
+}
 
-    // find the entry and return the function
-    auto it = m_map.find(key.str());
+shared_ptr<runtime::Executable> runtime::LRUCache::get_cached_entry(const Key& key)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto it = m_map.find(key);
     if (it == m_map.end())
     {
-        throw ngraph_error("Entry not found in cache");
-    }
-    else
-    {
-        // update list to push this reference to the front
-        for (auto itr = m_list.begin(); itr != m_list.end(); itr++)
-        {
-            if (*itr == shape)
-            {
-                m_list.remove(shape);
-                m_list.push_front(shape);
-                break;
-            }
-        }
-        return it->second;
+        m_statistics.misses++;
+        return nullptr;
     }
+
+    // update list to push this reference to the front
+    m_statistics.hits++;
+    m_list.splice(m_list.begin(), m_list, it->second.m_position);
+    return it->second.m_executable;
 }
 
-// Need the clone function to get the output shape so that
-// storage can be allocated for output
-shared_ptr<Function> runtime::LRUCache::get_cloned_function(const vector<int>& shape)
+void runtime::LRUCache::set_max_entries(size_t max_entries)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    convert_shape_to_string(shape, key);
-    // find the entry and return the function
-    auto it = m_clone_function_map.find(key.str());
-    if (it == m_clone_function_map.end())
-    {
-        throw ngraph_error("Cloned function not found");
-    }
-    return it->second;
+    m_max_entries = max_entries;
+    evict();
+}
+
+size_t runtime::LRUCache::get_max_entries() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_max_entries;
+}
+
+void runtime::LRUCache::set_max_bytes(size_t max_bytes)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_max_bytes = max_bytes;
+    evict();
+}
+
+size_t runtime::LRUCache::get_max_bytes() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_max_bytes;
+}
+
+runtime::LRUCache::Statistics runtime::LRUCache::get_statistics() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_statistics;
 }
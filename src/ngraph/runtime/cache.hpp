@@ -16,46 +16,90 @@
 
 #pragma once
 
-#include <algorithm>
-#include <iostream>
-#include <iterator>
 #include <list>
+#include <memory>
 #include <mutex>
-#include <sstream>
 #include <string>
 #include <unordered_map>
-#include "ngraph/function.hpp"
+#include <vector>
+
 #include "ngraph/runtime/executable.hpp"
-#include "ngraph/shape.hpp"
 
 namespace ngraph
 {
     namespace runtime
     {
+        /// \brief Cache of compiled executables with least recently used eviction, bounded by
+        ///    both the number of entries and their estimated size in bytes.
         class LRUCache : public std::enable_shared_from_this<LRUCache>
         {
         public:
-            using GraphCache = std::unordered_map<std::string, std::shared_ptr<Executable>>;
-            using ClonedFunctionMap = std::unordered_map<std::string, std::shared_ptr<Function>>;
+            /// \brief Cache key, typically the concatenated shapes of all inputs
+            using Key = std::vector<int64_t>;
+
+            /// \brief Counters describing the effectiveness of the cache
+            struct Statistics
+            {
+                size_t hits = 0;
+                size_t misses = 0;
+                size_t evictions = 0;
+                size_t entries = 0;
+                size_t bytes = 0;
+            };
 
+            /// \brief Create a cache limited to NGRAPH_CACHE_SIZE entries (default 1024) and
+            ///    an unlimited number of bytes
             LRUCache();
 
             virtual ~LRUCache();
 
-            void add_entry(const std::vector<int>& shape,
-                           std::shared_ptr<Executable> exec,
-                           std::shared_ptr<Function> func);
-            bool is_cached(const std::vector<int>& shape);
-            std::shared_ptr<Executable> get_cached_entry(const std::vector<int>& shape);
-            void convert_shape_to_string(const std::vector<int>& shape, std::ostringstream& key);
-            std::shared_ptr<Function> get_cloned_function(const std::vector<int>& shape);
+            /// \brief Add or replace an entry, then evict least recently used entries until
+            ///    the cache is within its limits again.
+            /// \param key The key of the entry
+            /// \param exec The compiled executable
+            /// \param byte_size The estimated memory footprint of exec
+            void add_entry(const Key& key, std::shared_ptr<Executable> exec, size_t byte_size = 0);
+
+            bool is_cached(const Key& key);
+
+            /// \brief Look up an entry and mark it most recently used. Counts a hit or a miss.
+            /// \returns The cached executable or nullptr if key is not cached
+            std::shared_ptr<Executable> get_cached_entry(const Key& key);
+
+            /// \brief Set the maximum number of entries, 0 means unlimited
+            void set_max_entries(size_t max_entries);
+            size_t get_max_entries() const;
+
+            /// \brief Set the maximum total estimated size of the entries, 0 means unlimited
+            void set_max_bytes(size_t max_bytes);
+            size_t get_max_bytes() const;
+
+            Statistics get_statistics() const;
+
+            static std::string key_to_string(const Key& key);
 
         private:
-            int m_cache_size;
-            GraphCache m_map;
-            ClonedFunctionMap m_clone_function_map;
-            std::list<std::vector<int>> m_list;
-            std::mutex m_mutex;
+            struct KeyHash
+            {
+                size_t operator()(const Key& key) const;
+            };
+
+            struct Entry
+            {
+                std::shared_ptr<Executable> m_executable;
+                size_t m_byte_size;
+                std::list<Key>::iterator m_position;
+            };
+
+            void evict();
+
+            size_t m_max_entries;
+            size_t m_max_bytes;
+            std::unordered_map<Key, Entry, KeyHash> m_map;
+            // Most recently used key first
+            std::list<Key> m_list;
+            Statistics m_statistics;
+            mutable std::mutex m_mutex;
         };
     }
 }
@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/runtime/constant_store.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::ConstantStore& runtime::ConstantStore::get()
+{
+    static ConstantStore store;
+    return store;
+}
+
+shared_ptr<runtime::AlignedBuffer>
+    runtime::ConstantStore::intern(const shared_ptr<AlignedBuffer>& buffer, size_t size)
+{
+    size_t hash = hash_bytes(buffer->get_ptr(), size);
+    lock_guard<mutex> lock(m_mutex);
+    auto range = m_entries.equal_range(hash);
+    for (auto it = range.first; it != range.second;)
+    {
+        auto existing = it->second.buffer.lock();
+        if (!existing)
+        {
+            it = m_entries.erase(it);
+            continue;
+        }
+        if (existing == buffer ||
+            (it->second.size == size && !memcmp(existing->get_ptr(), buffer->get_ptr(), size)))
+        {
+            return existing;
+        }
+        ++it;
+    }
+
+    // Entries of freed buffers with other hashes are only removed by a lookup of their hash, so
+    // sweep the whole store whenever it has grown a lot since the last sweep
+    if (m_entries.size() >= m_prune_threshold)
+    {
+        prune();
+        m_prune_threshold = max<size_t>(1024, 2 * m_entries.size());
+    }
+    m_entries.insert({hash, Entry{buffer, size}});
+    return buffer;
+}
+
+size_t runtime::ConstantStore::get_buffer_count()
+{
+    lock_guard<mutex> lock(m_mutex);
+    prune();
+    return m_entries.size();
+}
+
+void runtime::ConstantStore::prune()
+{
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        if (it->second.buffer.expired())
+        {
+            it = m_entries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
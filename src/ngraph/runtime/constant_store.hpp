@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ConstantStore;
+    }
+}
+
+/// \brief A content addressed store of constant data.
+///
+/// Interning a buffer returns the buffer of an earlier call with the same content, if one is
+/// still in use, so functions and executables with the same weights share one copy of them.
+/// The store only holds weak references; a buffer is freed when the last constant using it is
+/// destroyed. Interned buffers are shared and must not be modified.
+class NGRAPH_API ngraph::runtime::ConstantStore
+{
+public:
+    /// \brief The store shared by the whole process
+    static ConstantStore& get();
+
+    /// \brief Returns a buffer whose first size bytes equal those of buffer. This is buffer
+    ///        itself unless a buffer with the same content was interned before and is still
+    ///        alive.
+    std::shared_ptr<AlignedBuffer> intern(const std::shared_ptr<AlignedBuffer>& buffer,
+                                          size_t size);
+
+    /// \brief Number of interned buffers which are still alive
+    size_t get_buffer_count();
+
+private:
+    struct Entry
+    {
+        std::weak_ptr<AlignedBuffer> buffer;
+        size_t size;
+    };
+
+    void prune();
+
+    std::mutex m_mutex;
+    std::unordered_multimap<size_t, Entry> m_entries;
+    size_t m_prune_threshold{1024};
+};
@@ -0,0 +1,549 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <fstream>
+#include <mkldnn.h>
+#include <set>
+#include <spawn.h>
+#include <sstream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "ngraph/code_writer.hpp"
+#include "ngraph/cpio.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/cpu/cpu_aot.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+extern "C" const char* get_ngraph_version_string();
+
+#ifndef NGRAPH_CPU_AOT_CXX
+#define NGRAPH_CPU_AOT_CXX "c++"
+#endif
+
+static const size_t s_constant_alignment = 64;
+
+extern char** environ;
+
+// Splits flags on whitespace the way a shell splits unquoted words
+static vector<string> split_flags(const string& flags)
+{
+    vector<string> result;
+    stringstream ss(flags);
+    string flag;
+    while (ss >> flag)
+    {
+        result.push_back(flag);
+    }
+    return result;
+}
+
+// Runs the compiler without a shell, so that no path or flag is ever interpreted by one, with
+// its output written to log_path. Returns true if it exited successfully.
+static bool run_compiler(const vector<string>& arguments, const string& log_path)
+{
+    vector<char*> argv;
+    for (const string& argument : arguments)
+    {
+        argv.push_back(const_cast<char*>(argument.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(
+        &actions, STDOUT_FILENO, log_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+    pid_t pid;
+    int error = posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    if (error != 0)
+    {
+        throw ngraph_error("Failed to run " + arguments[0] + ": " + strerror(error));
+    }
+
+    int status;
+    while (waitpid(pid, &status, 0) == -1)
+    {
+        if (errno != EINTR)
+        {
+            throw ngraph_error("Failed to wait for " + arguments[0] + ": " + strerror(errno));
+        }
+    }
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static void write_binary_file(const string& path, const char* data, size_t size)
+{
+    ofstream out(path, ios::binary);
+    out.write(data, size);
+    if (!out)
+    {
+        throw ngraph_error("Failed to write " + path);
+    }
+}
+
+// Blobs are assembled into the library rather than spelled out as arrays in the source, which
+// keeps the compile time of large models independent of the size of their weights
+static void emit_blob(CodeWriter& writer, const string& symbol, const string& path)
+{
+    writer << "__asm__(\".section .rodata\\n\"\n";
+    writer << "        \".balign " << s_constant_alignment << "\\n\"\n";
+    writer << "        \".globl " << symbol << "\\n\"\n";
+    writer << "        \".hidden " << symbol << "\\n\"\n";
+    writer << "        \"" << symbol << ":\\n\"\n";
+    writer << "        \".incbin \\\"" << path << "\\\"\\n\"\n";
+    writer << "        \".previous\\n\");\n";
+    writer << "extern \"C\" __attribute__((visibility(\"hidden\"))) const char " << symbol
+           << "[];\n\n";
+}
+
+static void emit_tensors(CodeWriter& writer,
+                         const string& kind,
+                         const vector<pair<element::Type, Shape>>& tensors)
+{
+    writer << "static const size_t aot_" << kind << "_count = " << tensors.size() << ";\n";
+    writer << "static const char* const aot_" << kind << "_types[] = {";
+    for (auto& tensor : tensors)
+    {
+        writer << "\"" << tensor.first.get_type_name() << "\", ";
+    }
+    writer << "nullptr};\n";
+
+    // Shapes are concatenated, the extent of each is given by consecutive offsets
+    vector<size_t> offsets{0};
+    vector<size_t> shapes;
+    for (auto& tensor : tensors)
+    {
+        shapes.insert(shapes.end(), tensor.second.begin(), tensor.second.end());
+        offsets.push_back(shapes.size());
+    }
+    shapes.push_back(0);
+    writer << "static const size_t aot_" << kind << "_shape_offsets[] = {" << join(offsets)
+           << "};\n";
+    writer << "static const size_t aot_" << kind << "_shapes[] = {" << join(shapes) << "};\n\n";
+
+    writer << "extern \"C\" size_t ngraph_aot_" << kind << "_count()\n";
+    writer << "{\n";
+    writer << "    return aot_" << kind << "_count;\n";
+    writer << "}\n\n";
+    writer << "extern \"C\" const char* ngraph_aot_" << kind << "_type(size_t index)\n";
+    writer << "{\n";
+    writer << "    return aot_" << kind << "_types[index];\n";
+    writer << "}\n\n";
+    writer << "extern \"C\" size_t ngraph_aot_" << kind << "_rank(size_t index)\n";
+    writer << "{\n";
+    writer << "    return aot_" << kind << "_shape_offsets[index + 1] - aot_" << kind
+           << "_shape_offsets[index];\n";
+    writer << "}\n\n";
+    writer << "extern \"C\" const size_t* ngraph_aot_" << kind << "_shape(size_t index)\n";
+    writer << "{\n";
+    writer << "    return aot_" << kind << "_shapes + aot_" << kind << "_shape_offsets[index];\n";
+    writer << "}\n\n";
+}
+
+static string generate_aot_interface(const runtime::cpu::AOTModel& model,
+                                     const string& constants_path,
+                                     const string& descriptors_path,
+                                     const vector<size_t>& constant_offsets)
+{
+    CodeWriter writer;
+    writer << "\n// Interface of the ahead of time compiled library\n";
+    writer << "#include <algorithm>\n";
+    writer << "#include <exception>\n";
+    writer << "#include <mutex>\n";
+    writer << "#include <string>\n";
+    writer << "#include <vector>\n\n";
+
+    emit_blob(writer, "ngraph_aot_constants", constants_path);
+    emit_blob(writer, "ngraph_aot_descriptors", descriptors_path);
+
+    vector<size_t> offsets = constant_offsets;
+    offsets.push_back(0);
+    writer << "static const size_t aot_constant_count = " << model.constants.size() << ";\n";
+    writer << "static const size_t aot_constant_offsets[] = {" << join(offsets) << "};\n";
+    writer << "static const size_t aot_descriptors_size = " << model.mkldnn_descriptors.size()
+           << ";\n";
+    vector<size_t> buffer_sizes = model.memory_buffer_sizes;
+    buffer_sizes.push_back(0);
+    writer << "static const size_t aot_memory_buffer_count = " << model.memory_buffer_sizes.size()
+           << ";\n";
+    writer << "static const size_t aot_memory_buffer_sizes[] = {" << join(buffer_sizes)
+           << "};\n\n";
+
+    emit_tensors(writer, "input", model.inputs);
+    emit_tensors(writer, "output", model.outputs);
+
+    writer << R"(namespace
+{
+    struct AOTInstance
+    {
+        ngraph::runtime::cpu::CPURuntimeContext* ctx;
+        CPURuntimeContextCG* cg_ctx;
+        std::string error;
+    };
+
+    std::once_flag aot_bind_flag;
+}
+
+extern "C" void* ngraph_aot_create()
+{
+    std::call_once(aot_bind_flag, [] {
+        std::vector<void*> constants;
+        for (size_t i = 0; i < aot_constant_count; i++)
+        {
+            constants.push_back(const_cast<char*>(ngraph_aot_constants + aot_constant_offsets[i]));
+        }
+        bind_constants(constants.data());
+        bind_mkldnn_descriptors(ngraph_aot_descriptors, aot_descriptors_size);
+    });
+
+    auto ctx = new ngraph::runtime::cpu::CPURuntimeContext;
+    ctx->op_durations = nullptr;
+    ctx->p_en = new bool[aot_input_count + 1];
+    ctx->first_iteration = true;
+    ctx->scratchpad_buffer = nullptr;
+    ctx->states = nullptr;
+    ctx->pc = 0;
+    for (size_t i = 0; i < aot_memory_buffer_count; i++)
+    {
+        ctx->memory_buffers.push_back(new ngraph::runtime::AlignedBuffer()"
+           << "aot_memory_buffer_sizes[i], " << model.memory_buffer_alignment << R"());
+    }
+
+    auto instance = new AOTInstance;
+    instance->ctx = ctx;
+    instance->cg_ctx = init_cg_ctx();
+    return instance;
+}
+
+extern "C" const char* ngraph_aot_call(void* model, void** outputs, void** inputs)
+{
+    auto instance = static_cast<AOTInstance*>(model);
+    try
+    {
+        // Callers may change input data between calls without telling us
+        std::fill_n(instance->ctx->p_en, aot_input_count, true);
+        instance->ctx->pc = 0;
+        )"
+           << model.function_name << R"((inputs, outputs, instance->ctx, instance->cg_ctx);
+    }
+    catch (const std::exception& e)
+    {
+        instance->error = e.what();
+        return instance->error.c_str();
+    }
+    return nullptr;
+}
+
+extern "C" void ngraph_aot_destroy(void* model)
+{
+    auto instance = static_cast<AOTInstance*>(model);
+    destroy_cg_ctx(instance->cg_ctx);
+    for (auto buffer : instance->ctx->memory_buffers)
+    {
+        delete buffer;
+    }
+    delete[] instance->ctx->p_en;
+    delete instance->ctx;
+    delete instance;
+}
+)";
+    return writer.get_code();
+}
+
+// Path of the shared library defining address, or an empty string when it is not in one
+static string get_library_path(void* address)
+{
+    Dl_info info;
+    if (dladdr(address, &info) == 0 || info.dli_fname == nullptr)
+    {
+        return "";
+    }
+    string path = info.dli_fname;
+    if (path.find(".so") == string::npos)
+    {
+        return "";
+    }
+    return path;
+}
+
+void runtime::cpu::build_aot_library(const AOTModel& model, const string& library_path)
+{
+    static atomic<size_t> s_build_count{0};
+    string build_dir = file_util::path_join(
+        file_util::get_temp_directory_path(),
+        "ngraph_aot_" + to_string(getpid()) + "_" + to_string(s_build_count++));
+    file_util::remove_directory(build_dir);
+    file_util::make_directory(build_dir);
+
+    try
+    {
+        string constants_path = file_util::path_join(build_dir, "constants.bin");
+        vector<size_t> constant_offsets;
+        {
+            ofstream out(constants_path, ios::binary);
+            size_t offset = 0;
+            for (auto& constant : model.constants)
+            {
+                size_t aligned = (offset + s_constant_alignment - 1) / s_constant_alignment *
+                                 s_constant_alignment;
+                out << string(aligned - offset, '\0');
+                out.write(static_cast<const char*>(constant.first), constant.second);
+                constant_offsets.push_back(aligned);
+                offset = aligned + constant.second;
+            }
+            if (!out)
+            {
+                throw ngraph_error("Failed to write " + constants_path);
+            }
+        }
+        string descriptors_path = file_util::path_join(build_dir, "descriptors.bin");
+        write_binary_file(descriptors_path,
+                          model.mkldnn_descriptors.data(),
+                          model.mkldnn_descriptors.size());
+
+        string source_path = file_util::path_join(build_dir, model.function_name + "_aot.cpp");
+        string source =
+            model.source +
+            generate_aot_interface(model, constants_path, descriptors_path, constant_offsets);
+        write_binary_file(source_path, source.data(), source.size());
+
+        const char* env_cxx = getenv("NGRAPH_CPU_AOT_CXX");
+        const char* env_flags = getenv("NGRAPH_CPU_AOT_CXXFLAGS");
+        vector<string> command{env_cxx == nullptr ? NGRAPH_CPU_AOT_CXX : env_cxx,
+                               "-std=c++11",
+                               "-shared",
+                               "-fPIC",
+                               "-w"};
+        // The library may be loaded on another machine than the one it was built on, so it
+        // only targets the host CPU when the flags ask for it, e.g. with -march=native
+        for (const string& flag : split_flags(env_flags == nullptr ? "-O2" : env_flags))
+        {
+            command.push_back(flag);
+        }
+        // Same configuration the codegen compiler uses
+        command.push_back("-DNGRAPH_AOT");
+        command.push_back("-DEIGEN_MPL2_ONLY");
+#if defined(NGRAPH_TBB_ENABLE)
+        command.push_back("-DNGRAPH_TBB_ENABLE");
+#endif
+#if defined(NGRAPH_USE_LEGACY_MKLDNN)
+        command.push_back("-DNGRAPH_USE_LEGACY_MKLDNN");
+#endif
+#ifdef EIGEN_HEADERS_PATH
+        command.push_back(string("-I") + EIGEN_HEADERS_PATH);
+#endif
+#ifdef MKLDNN_HEADERS_PATH
+        command.push_back(string("-I") + MKLDNN_HEADERS_PATH);
+#endif
+#ifdef TBB_HEADERS_PATH
+        command.push_back(string("-I") + TBB_HEADERS_PATH);
+#endif
+#ifdef NGRAPH_HEADERS_PATH
+        command.push_back(string("-I") + NGRAPH_HEADERS_PATH);
+#endif
+        command.push_back("-o");
+        command.push_back(library_path);
+        command.push_back(source_path);
+
+        // Link the libraries the generated code calls into by file name, not by path, so the
+        // library records no directory of this machine. The dynamic loader finds them among the
+        // libraries the process already loaded, next to the library itself, or on the usual
+        // search path.
+        set<string> libraries{
+            get_library_path(reinterpret_cast<void*>(&runtime::cpu::build_aot_library)),
+            get_library_path(reinterpret_cast<void*>(&get_ngraph_version_string)),
+            get_library_path(reinterpret_cast<void*>(&mkldnn_engine_create))};
+        for (const string& library : libraries)
+        {
+            if (!library.empty())
+            {
+                command.push_back("-L" + file_util::get_directory(library));
+                command.push_back("-l:" + file_util::get_file_name(library));
+            }
+        }
+        command.push_back("-Wl,-rpath,$ORIGIN");
+
+        string log_path = file_util::path_join(build_dir, "build.log");
+        NGRAPH_DEBUG << "Building ahead of time library: " << join(command, " ");
+        if (!run_compiler(command, log_path))
+        {
+            throw ngraph_error("Failed to build " + library_path + ":\n" +
+                               file_util::read_file_to_string(log_path));
+        }
+    }
+    catch (...)
+    {
+        file_util::remove_directory(build_dir);
+        throw;
+    }
+    file_util::remove_directory(build_dir);
+}
+
+void runtime::cpu::save_aot_library(const vector<char>& library, ostream& output_stream)
+{
+    cpio::Writer writer(output_stream);
+    string si = "CPU Save File 1.0";
+    writer.write("save_info", si.data(), si.size());
+    writer.write("library", library.data(), library.size());
+}
+
+template <typename T>
+static T* find_symbol(void* library, const string& name)
+{
+    auto symbol = reinterpret_cast<T*>(dlsym(library, name.c_str()));
+    if (symbol == nullptr)
+    {
+        throw ngraph_error("Ahead of time library is missing " + name);
+    }
+    return symbol;
+}
+
+static element::Type find_element_type(const string& name)
+{
+    for (const element::Type* type : element::Type::get_known_types())
+    {
+        if (type->get_type_name() == name)
+        {
+            return *type;
+        }
+    }
+    throw ngraph_error("Ahead of time library uses unknown element type " + name);
+}
+
+static pair<element::Type, Shape> read_tensor(void* library, const string& kind, size_t index)
+{
+    auto type = find_symbol<const char*(size_t)>(library, "ngraph_aot_" + kind + "_type");
+    auto rank = find_symbol<size_t(size_t)>(library, "ngraph_aot_" + kind + "_rank");
+    auto shape = find_symbol<const size_t*(size_t)>(library, "ngraph_aot_" + kind + "_shape");
+    const size_t* dims = shape(index);
+    return make_pair(find_element_type(type(index)), Shape(dims, dims + rank(index)));
+}
+
+runtime::cpu::CPU_AOTExecutable::CPU_AOTExecutable(const string& library_path)
+    : m_library_contents(file_util::read_file_contents(library_path))
+{
+    m_library = dlopen(library_path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (m_library == nullptr)
+    {
+        const char* error = dlerror();
+        throw ngraph_error("Failed to load " + library_path + ": " +
+                           (error == nullptr ? "" : error));
+    }
+    try
+    {
+        m_create = find_symbol<CreateFunc>(m_library, "ngraph_aot_create");
+        m_call = find_symbol<CallFunc>(m_library, "ngraph_aot_call");
+        m_destroy = find_symbol<DestroyFunc>(m_library, "ngraph_aot_destroy");
+
+        size_t input_count = find_symbol<size_t()>(m_library, "ngraph_aot_input_count")();
+        for (size_t i = 0; i < input_count; i++)
+        {
+            auto tensor = read_tensor(m_library, "input", i);
+            m_parameters.push_back(make_shared<op::Parameter>(tensor.first, tensor.second));
+        }
+        size_t output_count = find_symbol<size_t()>(m_library, "ngraph_aot_output_count")();
+        for (size_t i = 0; i < output_count; i++)
+        {
+            // The graph is gone, results only describe the outputs
+            auto tensor = read_tensor(m_library, "output", i);
+            m_results.push_back(
+                make_shared<op::Result>(make_shared<op::Parameter>(tensor.first, tensor.second)));
+        }
+    }
+    catch (...)
+    {
+        dlclose(m_library);
+        throw;
+    }
+}
+
+runtime::cpu::CPU_AOTExecutable::~CPU_AOTExecutable()
+{
+    for (void* instance : m_instances)
+    {
+        m_destroy(instance);
+    }
+    dlclose(m_library);
+}
+
+void* runtime::cpu::CPU_AOTExecutable::acquire_instance()
+{
+    {
+        lock_guard<mutex> lock(m_instance_mutex);
+        if (!m_idle_instances.empty())
+        {
+            void* instance = m_idle_instances.back();
+            m_idle_instances.pop_back();
+            return instance;
+        }
+    }
+    void* instance = m_create();
+    lock_guard<mutex> lock(m_instance_mutex);
+    m_instances.push_back(instance);
+    return instance;
+}
+
+void runtime::cpu::CPU_AOTExecutable::release_instance(void* instance)
+{
+    lock_guard<mutex> lock(m_instance_mutex);
+    m_idle_instances.push_back(instance);
+}
+
+bool runtime::cpu::CPU_AOTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                           const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    vector<void*> output_data;
+    for (auto& tensor : outputs)
+    {
+        output_data.push_back(static_cast<CPUTensorView*>(tensor.get())->get_data_ptr());
+    }
+    vector<void*> input_data;
+    for (auto& tensor : inputs)
+    {
+        input_data.push_back(static_cast<CPUTensorView*>(tensor.get())->get_data_ptr());
+    }
+
+    void* instance = acquire_instance();
+    const char* error = m_call(instance, output_data.data(), input_data.data());
+    string message = error == nullptr ? "" : error;
+    release_instance(instance);
+    if (error != nullptr)
+    {
+        throw ngraph_error(message);
+    }
+    return true;
+}
+
+void runtime::cpu::CPU_AOTExecutable::save(ostream& output_stream)
+{
+    save_aot_library(m_library_contents, output_stream);
+}
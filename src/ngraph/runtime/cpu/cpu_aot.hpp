@@ -0,0 +1,119 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Everything a function compiled in codegen mode needs to run without the
+            ///        compiler that generated it
+            struct AOTModel
+            {
+                /// Name of the entry point in the generated source
+                std::string function_name;
+                std::string source;
+                /// Data and byte size of each constant, in the order bind_constants takes them
+                std::vector<std::pair<const void*, size_t>> constants;
+                /// Serialized memory descriptors of the MKL-DNN primitives
+                std::string mkldnn_descriptors;
+                std::vector<size_t> memory_buffer_sizes;
+                size_t memory_buffer_alignment;
+                std::vector<std::pair<element::Type, Shape>> inputs;
+                std::vector<std::pair<element::Type, Shape>> outputs;
+            };
+
+            /// \brief Builds a shared library running model with the system C++ compiler.
+            ///
+            /// The library embeds the constants and has the C interface
+            ///
+            ///     size_t ngraph_aot_input_count();
+            ///     const char* ngraph_aot_input_type(size_t index);
+            ///     size_t ngraph_aot_input_rank(size_t index);
+            ///     const size_t* ngraph_aot_input_shape(size_t index);
+            ///     (the same four for outputs)
+            ///     void* ngraph_aot_create();
+            ///     const char* ngraph_aot_call(void* instance, void** outputs, void** inputs);
+            ///     void ngraph_aot_destroy(void* instance);
+            ///
+            /// Types are element type names such as "f32". Buffers are dense and row-major.
+            /// An instance runs one call at a time; ngraph_aot_call returns nullptr on success
+            /// and the error message otherwise. The library links against the ngraph, CPU
+            /// backend and MKL-DNN libraries but needs neither clang nor LLVM. It finds them
+            /// when the process loaded them already, when they are installed in the directory
+            /// of the library ($ORIGIN), or on the search path of the dynamic loader.
+            ///
+            /// NGRAPH_CPU_AOT_CXX and NGRAPH_CPU_AOT_CXXFLAGS override the compiler and the
+            /// whitespace separated optimization flags it is given, -O2 by default. Add
+            /// -march=native to the flags for libraries only loaded on the build machine.
+            void build_aot_library(const AOTModel& model, const std::string& library_path);
+
+            /// \brief Writes the contents of a library built by build_aot_library in the format
+            ///        CPU_Backend::load reads
+            void save_aot_library(const std::vector<char>& library, std::ostream& output_stream);
+
+            /// \brief Executable calling into a library built by build_aot_library
+            class CPU_BACKEND_API CPU_AOTExecutable : public runtime::Executable
+            {
+            public:
+                CPU_AOTExecutable(const std::string& library_path);
+                ~CPU_AOTExecutable() override;
+
+                bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+                void save(std::ostream& output_stream) override;
+
+            private:
+                CPU_AOTExecutable(const CPU_AOTExecutable&) = delete;
+                CPU_AOTExecutable& operator=(const CPU_AOTExecutable&) = delete;
+
+                void* acquire_instance();
+                void release_instance(void* instance);
+
+                using CreateFunc = void*();
+                using CallFunc = const char*(void*, void**, void**);
+                using DestroyFunc = void(void*);
+
+                void* m_library;
+                std::vector<char> m_library_contents;
+                CreateFunc* m_create;
+                CallFunc* m_call;
+                DestroyFunc* m_destroy;
+
+                std::mutex m_instance_mutex;
+                /// Instances not running a call; a new one is created when none is idle
+                std::vector<void*> m_idle_instances;
+                std::vector<void*> m_instances;
+            };
+        }
+    }
+}
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <fstream>
+
 #if defined(NGRAPH_TBB_ENABLE)
 #include <tbb/tbb_stddef.h>
 #endif
@@ -21,9 +23,12 @@
 #include "cpu_backend_visibility.h"
 
 #include "ngraph/component_manager.hpp"
+#include "ngraph/cpio.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/cpu/cpu_aot.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
@@ -164,6 +169,84 @@ bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
     return rc;
 }
 
+void runtime::cpu::CPU_Executable::export_library(const string& library_path)
+{
+#if defined(NGRAPH_DEX_ONLY)
+    throw ngraph_error("Exporting a library requires a CPU backend built with codegen");
+#elif !defined(__linux__)
+    // The library is assembled and linked with ELF and GNU toolchain features
+    throw ngraph_error("Exporting a library is only supported on Linux");
+#else
+    FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before export_library().");
+    }
+    build_aot_library(instance.m_external_function->get_aot_model(), library_path);
+#endif
+}
+
+void runtime::cpu::CPU_Executable::save(ostream& output_stream)
+{
+    string library_path = file_util::tmp_filename(".so");
+    try
+    {
+        export_library(library_path);
+        save_aot_library(file_util::read_file_contents(library_path), output_stream);
+    }
+    catch (...)
+    {
+        file_util::remove_file(library_path);
+        throw;
+    }
+    file_util::remove_file(library_path);
+}
+
+shared_ptr<runtime::Executable> runtime::cpu::CPU_Backend::load(istream& input_stream)
+{
+    shared_ptr<Executable> exec;
+    cpio::Reader reader(input_stream);
+    auto file_info = reader.get_file_info();
+    string save_info;
+    for (const cpio::FileInfo& info : file_info)
+    {
+        if (info.get_name() == "save_info")
+        {
+            vector<char> buffer = reader.read(info);
+            save_info = string(buffer.data(), buffer.size());
+            break;
+        }
+    }
+    if (save_info == "CPU Save File 1.0")
+    {
+        for (const cpio::FileInfo& info : file_info)
+        {
+            if (info.get_name() == "library")
+            {
+                vector<char> buffer = reader.read(info);
+                string library_path = file_util::tmp_filename(".so");
+                {
+                    ofstream out(library_path, ios::binary);
+                    out.write(buffer.data(), buffer.size());
+                }
+                // The loaded library stays mapped after its file is removed
+                try
+                {
+                    exec = make_shared<CPU_AOTExecutable>(library_path);
+                }
+                catch (...)
+                {
+                    file_util::remove_file(library_path);
+                    throw;
+                }
+                file_util::remove_file(library_path);
+                break;
+            }
+        }
+    }
+    return exec;
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Executable> exec)
 {
     std::lock_guard<std::mutex> guard(m_exec_map_mutex);
@@ -65,6 +65,10 @@ namespace ngraph
 
                 void remove_compiled_function(std::shared_ptr<Executable> exec) override;
 
+                /// \brief Loads an executable saved by CPU_Executable::save. It runs without the
+                ///        codegen compiler.
+                std::shared_ptr<Executable> load(std::istream& input_stream) override;
+
                 Allocator* get_host_memory_allocator() override;
                 void set_host_memory_allocator(Allocator* allocator) override;
 
@@ -94,6 +98,14 @@ namespace ngraph
 
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
+                /// \brief Compiles the generated code into a standalone shared library with the
+                ///        C interface described at build_aot_library. Requires codegen mode
+                ///        and Linux.
+                void export_library(const std::string& library_path);
+
+                /// \brief Saves the library export_library builds
+                void save(std::ostream& output_stream) override;
+
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index,
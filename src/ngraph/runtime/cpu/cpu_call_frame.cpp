@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
+#include <sstream>
 #include <thread>
 
 #include "ngraph/runtime/aligned_buffer.hpp"
@@ -38,8 +40,8 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
     , m_compiled_function(compiled_function)
 {
     const auto envConcurrency = std::getenv("NGRAPH_CPU_CONCURRENCY");
-    m_num_ctx = envConcurrency == nullptr ? 1 : std::atoi(envConcurrency);
-    if (m_num_ctx > std::thread::hardware_concurrency())
+    m_initial_ctx = envConcurrency == nullptr ? 1 : std::atoi(envConcurrency);
+    if (m_initial_ctx > std::thread::hardware_concurrency())
     {
         throw ngraph_error(
             "Unexpected value specified for NGRAPH_CPU_CONCURRENCY "
@@ -47,6 +49,18 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
             std::string(envConcurrency) + "). Please specify a value in range [1-" +
             std::to_string(std::thread::hardware_concurrency()) + "]");
     }
+    // Each context holds its own intermediate buffers, so the pool only grows past
+    // NGRAPH_CPU_CONCURRENCY when NGRAPH_CPU_MAX_CONCURRENCY allows it. Concurrent calls which
+    // find every context busy then create another one.
+    const auto envMaxConcurrency = std::getenv("NGRAPH_CPU_MAX_CONCURRENCY");
+    m_max_ctx = envMaxConcurrency == nullptr ? m_initial_ctx : std::atoi(envMaxConcurrency);
+    m_max_ctx = std::max<size_t>({m_max_ctx, m_initial_ctx, 1});
+    if (!m_external_function->is_direct_execution())
+    {
+        // single context for codegen
+        m_max_ctx = m_initial_ctx;
+    }
+    m_ctx_slots.reset(new ContextSlot[m_max_ctx]);
 
     setup_runtime_context(allocator);
     if (!m_external_function->is_direct_execution())
@@ -72,91 +86,299 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     const size_t id,
     const bool disable_caching)
 {
-    vector<void*> inputs;
-    vector<void*> outputs;
+    ContextSlot& slot = m_ctx_slots[id];
+    auto ctx = get_context(id);
+    slot.inputs.clear();
+    slot.outputs.clear();
 
     for (size_t i = 0; i < input_tvs.size(); i++)
     {
-        shared_ptr<runtime::cpu::CPUTensorView> tv =
-            static_pointer_cast<runtime::cpu::CPUTensorView>(input_tvs[i]);
+        auto tv = static_cast<runtime::cpu::CPUTensorView*>(input_tvs[i].get());
         if (disable_caching)
         {
-            m_ctx_vec[id]->p_en[i] = true;
+            ctx->p_en[i] = true;
         }
         else
         {
-            m_ctx_vec[id]->p_en[i] = tv->get_stale();
+            ctx->p_en[i] = tv->get_stale();
         }
 
-        inputs.push_back(tv->get_data_ptr());
+        slot.inputs.push_back(tv->get_data_ptr());
     }
     for (size_t i = 0; i < output_tvs.size(); i++)
     {
-        shared_ptr<runtime::cpu::CPUTensorView> tv =
-            static_pointer_cast<runtime::cpu::CPUTensorView>(output_tvs[i]);
-        outputs.push_back(tv->get_data_ptr());
+        auto tv = static_cast<runtime::cpu::CPUTensorView*>(output_tvs[i].get());
+        slot.outputs.push_back(tv->get_data_ptr());
     }
 
+    execute(id);
+}
+
+void runtime::cpu::CPU_CallFrame::execute(const size_t id)
+{
+    ContextSlot& slot = m_ctx_slots[id];
+
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
-        m_compiled_function(inputs.data(), outputs.data(), m_ctx_vec[id], cg_ctx);
+        m_compiled_function(slot.inputs.data(), slot.outputs.data(), get_context(id), cg_ctx);
     }
     else
     {
-        m_external_function->get_executor()(m_ctx_vec[id], inputs, outputs);
+        m_external_function->get_executor()(get_context(id), slot.inputs, slot.outputs);
     }
 
     if (runtime::cpu::IsTracingEnabled())
     {
         GenerateTimeline(m_external_function->get_op_attrs(),
-                         m_ctx_vec[id]->op_durations,
+                         get_context(id)->op_durations,
                          m_external_function->get_function_name() + ".timeline.json");
     }
 }
 
+size_t runtime::cpu::CPU_CallFrame::try_acquire_context(size_t preferred_id)
+{
+    auto try_slot = [this](size_t id) {
+        ContextSlot& slot = m_ctx_slots[id];
+        bool busy = false;
+        return slot.ctx.load(std::memory_order_acquire) != nullptr &&
+               !slot.busy.load(std::memory_order_relaxed) &&
+               slot.busy.compare_exchange_strong(busy, true);
+    };
+
+    size_t num_ctx = m_num_ctx.load();
+    if (preferred_id < num_ctx && try_slot(preferred_id))
+    {
+        return preferred_id;
+    }
+    for (size_t id = 0; id < num_ctx; id++)
+    {
+        if (id != preferred_id && try_slot(id))
+        {
+            return id;
+        }
+    }
+
+    // Every context is busy, add one while the pool may grow. The context is created before a
+    // slot is claimed, so a failure to create it leaves the pool as it was. The slot is owned
+    // by this call before its context is published.
+    if (num_ctx >= m_max_ctx)
+    {
+        return m_max_ctx;
+    }
+    CPURuntimeContext* ctx = create_runtime_context();
+    while (num_ctx < m_max_ctx)
+    {
+        if (m_num_ctx.compare_exchange_weak(num_ctx, num_ctx + 1))
+        {
+            ContextSlot& slot = m_ctx_slots[num_ctx];
+            slot.busy.store(true);
+            slot.ctx.store(ctx, std::memory_order_release);
+            return num_ctx;
+        }
+    }
+    // Other calls filled the pool meanwhile
+    destroy_runtime_context(ctx);
+    return m_max_ctx;
+}
+
+size_t runtime::cpu::CPU_CallFrame::acquire_context(bool& affine)
+{
+    // The context this thread used last is the one most likely to have cached the inputs of
+    // its next call
+    thread::id this_thread_id = this_thread::get_id();
+    size_t preferred_id = m_max_ctx;
+    size_t num_ctx = m_num_ctx.load();
+    for (size_t id = 0; id < num_ctx; id++)
+    {
+        if (m_ctx_slots[id].last_thread.load(std::memory_order_relaxed) == this_thread_id)
+        {
+            preferred_id = id;
+            break;
+        }
+    }
+
+    size_t id = try_acquire_context(preferred_id);
+    if (id == m_max_ctx)
+    {
+        auto start = chrono::steady_clock::now();
+        unique_lock<mutex> lock(m_mutex);
+        m_num_waiting++;
+        m_cv.wait(lock, [&] {
+            id = try_acquire_context(preferred_id);
+            return id != m_max_ctx;
+        });
+        m_num_waiting--;
+        m_waits++;
+        m_wait_microseconds += chrono::duration_cast<chrono::microseconds>(
+                                   chrono::steady_clock::now() - start)
+                                   .count();
+    }
+    affine = id == preferred_id;
+    m_ctx_slots[id].last_thread.store(this_thread_id, std::memory_order_relaxed);
+    return id;
+}
+
+void runtime::cpu::CPU_CallFrame::release_context(size_t id)
+{
+    m_ctx_slots[id].busy.store(false);
+    // A waiter either sees the context free when it checks, or is counted here and notified
+    if (m_num_waiting.load() > 0)
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_cv.notify_one();
+    }
+}
+
 void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
 {
-    size_t id = 0;
-    auto disable_caching = false;
+    bool affine = false;
+    size_t id = acquire_context(affine);
+    ContextSlot& slot = m_ctx_slots[id];
+
+    // Staleness hints only apply to the data a context cached if it last ran on the same input
+    // buffers
+    bool disable_caching = !slot.has_run || slot.last_inputs.size() != input_tvs.size();
+    slot.last_inputs.resize(input_tvs.size());
+    for (size_t i = 0; i < input_tvs.size(); i++)
     {
-        std::unique_lock<std::mutex> lck(m_mutex);
-        while (m_num_ctx_available == 0)
+        void* data = static_cast<runtime::cpu::CPUTensorView*>(input_tvs[i].get())->get_data_ptr();
+        if (slot.last_inputs[i] != data)
         {
-            m_cv.wait(lck);
+            disable_caching = true;
+            slot.last_inputs[i] = data;
         }
+    }
+    slot.has_run = true;
+    slot.calls.fetch_add(1, std::memory_order_relaxed);
+    slot.affine_calls.fetch_add(affine ? 1 : 0, std::memory_order_relaxed);
+    slot.cached_calls.fetch_add(disable_caching ? 0 : 1, std::memory_order_relaxed);
 
-        for (size_t i = 0; i < m_num_ctx; i++)
+    try
+    {
+        get_context(id)->pc = 0;
+        propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+        inner_call(output_tvs, input_tvs, id, disable_caching);
+    }
+    catch (...)
+    {
+        // The context may hold partial results of the failed call
+        slot.has_run = false;
+        release_context(id);
+        throw;
+    }
+    release_context(id);
+}
+
+void runtime::cpu::CPU_CallFrame::call(const CPU_CallBinding& binding,
+                                       void* const* outputs,
+                                       void* const* inputs)
+{
+    if (binding.m_call_frame != this)
+    {
+        throw ngraph_error("Call binding was created for a different call frame");
+    }
+
+    bool affine = false;
+    size_t id = acquire_context(affine);
+    ContextSlot& slot = m_ctx_slots[id];
+    auto ctx = get_context(id);
+
+    // Nothing tells whether caller-owned buffers changed, so the cached data of the context is
+    // neither used now nor by the next call on tensors
+    slot.has_run = false;
+    slot.calls.fetch_add(1, std::memory_order_relaxed);
+    slot.affine_calls.fetch_add(affine ? 1 : 0, std::memory_order_relaxed);
+    slot.inputs.assign(inputs, inputs + binding.get_input_count());
+    slot.outputs.assign(outputs, outputs + binding.get_output_count());
+    for (size_t i = 0; i < binding.get_input_count(); i++)
+    {
+        ctx->p_en[i] = true;
+    }
+
+    try
+    {
+        ctx->pc = 0;
+        execute(id);
+    }
+    catch (...)
+    {
+        release_context(id);
+        throw;
+    }
+    release_context(id);
+}
+
+static vector<size_t>
+    check_bound_buffers(const string& kind,
+                        const vector<runtime::cpu::CPU_CallBinding::Buffer>& buffers,
+                        const runtime::cpu::LayoutDescriptorPtrs& layouts)
+{
+    if (buffers.size() != layouts.size())
+    {
+        throw ngraph_error("Call binding has " + to_string(buffers.size()) + " " + kind +
+                           "s, the function has " + to_string(layouts.size()));
+    }
+    vector<size_t> sizes;
+    for (size_t i = 0; i < buffers.size(); i++)
+    {
+        auto& buffer = buffers[i];
+        auto& layout = layouts[i];
+        if (buffer.element_type != layout->get_element_type() ||
+            buffer.shape != layout->get_shape())
         {
-            if (m_id_pool[i])
-            {
-                id = i;
-                break;
-            }
+            stringstream ss;
+            ss << "Call binding " << kind << " " << i << " is " << buffer.element_type
+               << buffer.shape << ", the function expects " << layout->get_element_type()
+               << layout->get_shape();
+            throw ngraph_error(ss.str());
         }
-        NGRAPH_CHECK(id != m_num_ctx);
-        m_id_pool[id] = false;
-        if (id != m_prev_ctx)
+        if (!buffer.strides.empty() && buffer.strides != row_major_strides(buffer.shape))
         {
-            // Disable caching since staleness hints are no longer
-            // applicable to this context
-            disable_caching = true;
+            throw ngraph_error("Call binding " + kind + " " + to_string(i) +
+                               " is strided, only dense buffers are supported");
         }
-        m_prev_ctx = id;
-        m_num_ctx_available--;
+        if (!buffer.compiled_layout && !layout->is_row_major_layout())
+        {
+            throw ngraph_error("Call binding " + kind + " " + to_string(i) +
+                               " is row-major, the function was compiled for a blocked layout");
+        }
+        sizes.push_back(buffer.compiled_layout
+                            ? layout->get_allocated_size()
+                            : shape_size(buffer.shape) * buffer.element_type.size());
     }
+    return sizes;
+}
 
-    m_ctx_vec[id]->pc = 0;
-    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
+runtime::cpu::CPU_CallBinding
+    runtime::cpu::CPU_CallFrame::bind(const vector<CPU_CallBinding::Buffer>& outputs,
+                                      const vector<CPU_CallBinding::Buffer>& inputs) const
+{
+    CPU_CallBinding binding(this);
+    binding.m_input_sizes = check_bound_buffers(
+        "input", inputs, m_external_function->get_parameter_layout_descriptors());
+    binding.m_output_sizes = check_bound_buffers(
+        "output", outputs, m_external_function->get_result_layout_descriptors());
+    return binding;
+}
 
-    m_mutex.lock();
-    m_id_pool[id] = true;
-    m_num_ctx_available++;
-    m_mutex.unlock();
-    m_cv.notify_one();
+runtime::cpu::ContextPoolStatistics
+    runtime::cpu::CPU_CallFrame::get_context_pool_statistics() const
+{
+    ContextPoolStatistics statistics;
+    statistics.contexts = m_num_ctx.load();
+    for (size_t id = 0; id < statistics.contexts; id++)
+    {
+        const ContextSlot& slot = m_ctx_slots[id];
+        statistics.calls += slot.calls.load(std::memory_order_relaxed);
+        statistics.affine_calls += slot.affine_calls.load(std::memory_order_relaxed);
+        statistics.cached_calls += slot.cached_calls.load(std::memory_order_relaxed);
+    }
+    statistics.waits = m_waits.load();
+    statistics.wait_microseconds = m_wait_microseconds.load();
+    return statistics;
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -179,130 +401,140 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
     }
 }
 
-void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
+runtime::cpu::CPURuntimeContext* runtime::cpu::CPU_CallFrame::create_runtime_context()
 {
-    for (size_t i = 0; i < m_num_ctx; i++)
-    {
-        m_id_pool[i] = true;
-        auto ctx = new CPURuntimeContext;
-        m_ctx_vec.push_back(ctx);
+    auto ctx = new CPURuntimeContext;
 
-        ctx->pc = 0;
-        ctx->op_durations = nullptr;
-        if (runtime::cpu::IsTracingEnabled())
-        {
-            ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
-        }
-        ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+    ctx->pc = 0;
+    ctx->op_durations = nullptr;
+    if (runtime::cpu::IsTracingEnabled())
+    {
+        ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
+    }
+    ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
 
-        ctx->first_iteration = true;
+    ctx->first_iteration = true;
 
-        ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
+    ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
 
-        // Create temporary buffer pools
-        size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
-        for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
-        {
-            auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
-            ctx->memory_buffers.push_back(buffer);
-        }
-        const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
-        // Create scratchpad
-        auto scratchpad_size = mkldnn_emitter->get_max_scratchpad_size();
-        if (m_external_function->is_direct_execution())
+    // Create temporary buffer pools
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+    {
+        auto buffer = new AlignedBuffer(buffer_size, alignment, m_allocator);
+        ctx->memory_buffers.push_back(buffer);
+    }
+    const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
+    // Create scratchpad
+    auto scratchpad_size = mkldnn_emitter->get_max_scratchpad_size();
+    if (m_external_function->is_direct_execution())
+    {
+        ctx->mkldnn_primitives =
+            std::vector<mkldnn::primitive*>(mkldnn_emitter->get_mkldnn_primitives().size());
+        ctx->mkldnn_memories =
+            std::vector<mkldnn::memory*>(mkldnn_emitter->get_mkldnn_memories().size());
+        ctx->mkldnn_scratchpad_mds = std::vector<mkldnn::memory::desc*>(
+            mkldnn_emitter->get_mkldnn_scratchpad_mds().size());
+        if (scratchpad_size > 0)
         {
-            ctx->mkldnn_primitives =
-                std::vector<mkldnn::primitive*>(mkldnn_emitter->get_mkldnn_primitives().size());
-            ctx->mkldnn_memories =
-                std::vector<mkldnn::memory*>(mkldnn_emitter->get_mkldnn_memories().size());
-            ctx->mkldnn_scratchpad_mds = std::vector<mkldnn::memory::desc*>(
-                mkldnn_emitter->get_mkldnn_scratchpad_mds().size());
-            if (scratchpad_size > 0)
-            {
-                ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, allocator);
-            }
-            else
-            {
-                ctx->scratchpad_buffer = nullptr;
-            }
+            ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, m_allocator);
         }
         else
         {
-            // single thread for codegen
-            NGRAPH_CHECK(m_num_ctx == 1);
+            ctx->scratchpad_buffer = nullptr;
         }
+    }
+    else
+    {
+        // single thread for codegen
+        NGRAPH_CHECK(m_max_ctx == 1);
+    }
 
-        ctx->states = m_external_function->m_states.data();
+    ctx->states = m_external_function->m_states.data();
 #if defined(NGRAPH_TBB_ENABLE)
-        if (m_external_function->is_direct_execution() &&
-            std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
-        {
-            // For codegen mode, graph and global control are now part of the code generated
-            // CPURuntimeContextCG class.
-            ctx->G = new tbb::flow::graph;
-            const auto envParallelism = std::getenv("NGRAPH_INTER_OP_PARALLELISM");
-            const auto parallelism = envParallelism == nullptr ? 1 : std::atoi(envParallelism);
-            ctx->c =
-                new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
-        }
-#endif
+    if (m_external_function->is_direct_execution() &&
+        std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    {
+        // For codegen mode, graph and global control are now part of the code generated
+        // CPURuntimeContextCG class.
+        ctx->G = new tbb::flow::graph;
+        const auto envParallelism = std::getenv("NGRAPH_INTER_OP_PARALLELISM");
+        const auto parallelism = envParallelism == nullptr ? 1 : std::atoi(envParallelism);
+        ctx->c =
+            new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
     }
-    m_num_ctx_available = m_num_ctx;
+#endif
+    return ctx;
 }
 
-void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
+void runtime::cpu::CPU_CallFrame::destroy_runtime_context(CPURuntimeContext* ctx)
 {
-    for (size_t i = 0; i < m_num_ctx; i++)
+    delete[] ctx->op_durations;
+    delete[] ctx->p_en;
+    for (auto p : ctx->mkldnn_primitives)
     {
-        auto ctx = m_ctx_vec.back();
-        m_ctx_vec.pop_back();
+        delete p;
+    }
+    for (auto m : ctx->mkldnn_memories)
+    {
+        delete m;
+    }
+    for (auto buffer : ctx->memory_buffers)
+    {
+        delete buffer;
+    }
+    for (auto s : ctx->mkldnn_scratchpad_mds)
+    {
+        delete s;
+    }
+    if (m_external_function->is_direct_execution())
+    {
+        delete ctx->scratchpad_buffer;
+    }
 
-        delete[] ctx->op_durations;
-        delete[] ctx->p_en;
-        for (auto p : ctx->mkldnn_primitives)
-        {
-            delete p;
-        }
-        for (auto m : ctx->mkldnn_memories)
-        {
-            delete m;
-        }
-        for (auto buffer : ctx->memory_buffers)
-        {
-            delete buffer;
-        }
-        for (auto s : ctx->mkldnn_scratchpad_mds)
-        {
-            delete s;
-        }
-        if (m_external_function->is_direct_execution())
+#if defined(NGRAPH_TBB_ENABLE)
+    if (m_external_function->is_direct_execution() &&
+        std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    {
+        // For codegen mode, graph and global control are now part of a code generated
+        // CPURuntimeContext class.
+
+        // delete graph G and nodes in G
+        ctx->G->wait_for_all();
+        std::vector<tbb::flow::graph_node*> to_be_deleted;
+        for (auto it = ctx->G->begin(); it != ctx->G->end(); it++)
         {
-            delete ctx->scratchpad_buffer;
+            to_be_deleted.push_back(&(*it));
         }
-
-#if defined(NGRAPH_TBB_ENABLE)
-        if (m_external_function->is_direct_execution() &&
-            std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+        delete ctx->G;
+        for (auto node : to_be_deleted)
         {
-            // For codegen mode, graph and global control are now part of a code generated
-            // CPURuntimeContext class.
-
-            // delete graph G and nodes in G
-            ctx->G->wait_for_all();
-            std::vector<tbb::flow::graph_node*> to_be_deleted;
-            for (auto it = ctx->G->begin(); it != ctx->G->end(); it++)
-            {
-                to_be_deleted.push_back(&(*it));
-            }
-            delete ctx->G;
-            for (auto node : to_be_deleted)
-            {
-                delete node;
-            }
-            delete ctx->c;
+            delete node;
         }
+        delete ctx->c;
+    }
 #endif
-        delete ctx;
+    delete ctx;
+}
+
+void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
+{
+    m_allocator = allocator;
+    for (size_t id = 0; id < m_initial_ctx; id++)
+    {
+        m_ctx_slots[id].ctx.store(create_runtime_context(), std::memory_order_release);
+    }
+    m_num_ctx = m_initial_ctx;
+}
+
+void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
+{
+    for (size_t id = m_num_ctx.load(); id-- > 0;)
+    {
+        ContextSlot& slot = m_ctx_slots[id];
+        destroy_runtime_context(slot.ctx.exchange(nullptr));
+        slot.last_inputs.clear();
+        slot.has_run = false;
     }
-    m_num_ctx_available = 0;
+    m_num_ctx = 0;
 }
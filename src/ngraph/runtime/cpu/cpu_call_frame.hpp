@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "ngraph/function.hpp"
@@ -51,6 +53,74 @@ namespace ngraph
             using DestroyContextFuncCG = std::function<DestroyContextFuncTy>;
             using EntryPoint = std::function<EntryPointTy>;
 
+            /// \brief Counters describing how calls obtained an execution context
+            struct ContextPoolStatistics
+            {
+                /// Number of calls
+                size_t calls = 0;
+                /// Calls which reused the context the calling thread used last
+                size_t affine_calls = 0;
+                /// Calls which could skip copying inputs that were cached by the context
+                size_t cached_calls = 0;
+                /// Calls which had to wait for a context because all of them were busy
+                size_t waits = 0;
+                /// Total time calls waited for a context
+                size_t wait_microseconds = 0;
+                /// Number of contexts created
+                size_t contexts = 0;
+            };
+
+            class CPU_CallFrame;
+
+            /// \brief Caller-owned buffers bound to the inputs and outputs of a compiled function.
+            ///
+            /// CPU_CallFrame::bind checks the buffer descriptions once so that CPU_CallFrame::call
+            /// can take raw pointers, without wrapping them in tensors on every call.
+            class CPU_CallBinding
+            {
+            public:
+                /// \brief Description of a buffer passed to a call
+                struct Buffer
+                {
+                    Buffer(const element::Type& element_type,
+                           const Shape& shape,
+                           const Strides& strides = Strides{},
+                           bool compiled_layout = false)
+                        : element_type(element_type)
+                        , shape(shape)
+                        , strides(strides)
+                        , compiled_layout(compiled_layout)
+                    {
+                    }
+
+                    element::Type element_type;
+                    Shape shape;
+                    /// Strides in elements of a row-major buffer, empty if it is dense
+                    Strides strides;
+                    /// The buffer holds the layout the function was compiled for, which may be a
+                    /// blocked MKL-DNN layout, instead of a row-major one
+                    bool compiled_layout;
+                };
+
+                size_t get_input_count() const { return m_input_sizes.size(); }
+                size_t get_output_count() const { return m_output_sizes.size(); }
+                /// \brief Number of bytes a call reads from input i
+                size_t get_input_size(size_t i) const { return m_input_sizes.at(i); }
+                /// \brief Number of bytes a call writes to output i
+                size_t get_output_size(size_t i) const { return m_output_sizes.at(i); }
+
+            private:
+                friend class CPU_CallFrame;
+                CPU_CallBinding(const CPU_CallFrame* call_frame)
+                    : m_call_frame(call_frame)
+                {
+                }
+
+                const CPU_CallFrame* m_call_frame;
+                std::vector<size_t> m_input_sizes;
+                std::vector<size_t> m_output_sizes;
+            };
+
             // Compile and execute graphs
             class CPU_CallFrame
             {
@@ -70,6 +140,22 @@ namespace ngraph
                 void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+                /// \brief Check caller-owned buffers against the parameters and results of the
+                ///        function, for calls that pass raw pointers.
+                ///
+                /// Throws ngraph_error if a buffer does not match the compiled function.
+                CPU_CallBinding bind(const std::vector<CPU_CallBinding::Buffer>& outputs,
+                                     const std::vector<CPU_CallBinding::Buffer>& inputs) const;
+
+                /// \brief Invoke the function on the buffers described by a binding of this call
+                ///        frame, without allocating.
+                ///
+                /// The inputs are treated as changed since the previous call, so no input data
+                /// cached by the execution context is reused.
+                void call(const CPU_CallBinding& binding,
+                          void* const* outputs,
+                          void* const* inputs);
+
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
@@ -77,6 +163,8 @@ namespace ngraph
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
 
+                ContextPoolStatistics get_context_pool_statistics() const;
+
             protected:
                 CPU_CallFrame(const CPU_CallFrame&) = delete;
                 CPU_CallFrame(CPU_CallFrame&&) = delete;
@@ -86,16 +174,57 @@ namespace ngraph
                                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
                                 const size_t id,
                                 const bool disable_caching = true);
+                /// Runs the function on the buffers gathered in the slot of context id
+                void execute(const size_t id);
+
+                /// \brief An execution context and the state to hand it out without locking.
+                ///        A call owns the slot while busy is set.
+                struct ContextSlot
+                {
+                    /// Null until the context is created
+                    std::atomic<CPURuntimeContext*> ctx{nullptr};
+                    std::atomic<bool> busy{false};
+                    /// The thread that acquired the slot last, a hint for its next call
+                    std::atomic<std::thread::id> last_thread{std::thread::id()};
+                    /// Input buffers of the last call, whose data the context may have cached
+                    std::vector<void*> last_inputs;
+                    /// Buffers of the current call, kept to reuse their storage
+                    std::vector<void*> inputs;
+                    std::vector<void*> outputs;
+                    bool has_run = false;
+                    // Counters only updated by the call owning the slot
+                    std::atomic<size_t> calls{0};
+                    std::atomic<size_t> affine_calls{0};
+                    std::atomic<size_t> cached_calls{0};
+                };
+
+                CPURuntimeContext* get_context(size_t id) const
+                {
+                    return m_ctx_slots[id].ctx.load(std::memory_order_acquire);
+                }
+                CPURuntimeContext* create_runtime_context();
+                void destroy_runtime_context(CPURuntimeContext* ctx);
+                /// Acquires an idle context, preferring preferred_id, or creates a new one
+                /// if all are busy. Returns m_max_ctx if there is none.
+                size_t try_acquire_context(size_t preferred_id);
+                size_t acquire_context(bool& affine);
+                void release_context(size_t id);
 
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
+                runtime::Allocator* m_allocator = nullptr;
+
+                std::unique_ptr<ContextSlot[]> m_ctx_slots;
+                /// Number of slots whose context has been or is being created
+                std::atomic<size_t> m_num_ctx{0};
+                size_t m_initial_ctx = 1;
+                size_t m_max_ctx = 1;
 
+                // Only used by calls waiting for a context when all contexts are busy
                 std::mutex m_mutex;
                 std::condition_variable m_cv;
-                volatile size_t m_num_ctx_available = 0;
-                size_t m_prev_ctx = 0;
-                size_t m_num_ctx = 1;
-                std::unordered_map<size_t, bool> m_id_pool;
-                std::vector<CPURuntimeContext*> m_ctx_vec;
+                std::atomic<size_t> m_num_waiting{0};
+                std::atomic<size_t> m_waits{0};
+                std::atomic<size_t> m_wait_microseconds{0};
 
                 // Codegen specific
 
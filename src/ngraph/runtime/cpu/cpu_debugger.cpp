@@ -49,7 +49,7 @@ runtime::cpu::CPU_Debugger::~CPU_Debugger()
 
 bool runtime::cpu::CPU_Debugger::step()
 {
-    auto ctx = m_callframe.m_ctx_vec[0];
+    auto ctx = m_callframe.get_context(0);
     if (ctx->pc >= m_callframe.m_external_function->op_names.size())
     {
         return false;
@@ -67,7 +67,7 @@ bool runtime::cpu::CPU_Debugger::step()
 
 void runtime::cpu::CPU_Debugger::resume()
 {
-    auto ctx = m_callframe.m_ctx_vec[0];
+    auto ctx = m_callframe.get_context(0);
     if (ctx->pc >= m_callframe.m_external_function->op_names.size())
     {
         return;
@@ -82,7 +82,7 @@ void runtime::cpu::CPU_Debugger::call(const std::vector<std::shared_ptr<runtime:
 {
     m_outputs.assign(outputs.begin(), outputs.end());
     m_inputs.assign(inputs.begin(), inputs.end());
-    m_callframe.m_ctx_vec[0]->pc = 0;
+    m_callframe.get_context(0)->pc = 0;
     m_callframe.inner_call(m_outputs, m_inputs, 0);
 }
 
@@ -107,7 +107,7 @@ bool runtime::cpu::CPU_Debugger::add_breakpoint(std::shared_ptr<Node> op)
     std::tie(found, pc) = find_pc_for_node(op);
     if (found)
     {
-        m_callframe.m_ctx_vec[0]->breakpoints.insert(pc);
+        m_callframe.get_context(0)->breakpoints.insert(pc);
         return true;
     }
     return false;
@@ -120,7 +120,7 @@ bool runtime::cpu::CPU_Debugger::delete_breakpoint(std::shared_ptr<Node> op)
     std::tie(found, pc) = find_pc_for_node(op);
     if (found)
     {
-        m_callframe.m_ctx_vec[0]->breakpoints.erase(pc);
+        m_callframe.get_context(0)->breakpoints.erase(pc);
         return true;
     }
     return false;
@@ -132,13 +132,13 @@ void* runtime::cpu::CPU_Debugger::inspect(std::shared_ptr<Node> op, size_t outpu
     {
         auto index = m_callframe.m_external_function->get_buffer_index(op->get_name() + "_" +
                                                                        to_string(output_index));
-        return m_callframe.m_ctx_vec[0]->buffer_data[index];
+        return m_callframe.get_context(0)->buffer_data[index];
     }
     else
     {
         auto index = m_callframe.m_external_function->m_buffer_indices.at(op->get_name() + "_" +
                                                                           to_string(output_index));
-        return m_callframe.m_ctx_vec[0]->buffer_data[index];
+        return m_callframe.get_context(0)->buffer_data[index];
     }
 }
 
@@ -16,6 +16,7 @@
 
 #include <cstdlib>
 #include <fstream>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -29,6 +30,10 @@
 #include <tbb/flow_graph.h>
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #if !defined(NGRAPH_DEX_ONLY)
 #include "ngraph/code_writer.hpp"
 #include "ngraph/codegen/compiler.hpp"
@@ -44,6 +49,7 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
@@ -120,6 +126,7 @@
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/quantized_convolution.hpp"
 #include "ngraph/op/quantized_dot.hpp"
+#include "ngraph/op/recv.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
@@ -129,6 +136,7 @@
 #include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/scatter_nd_add.hpp"
 #include "ngraph/op/select.hpp"
+#include "ngraph/op/send.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/sign.hpp"
 #include "ngraph/op/sin.hpp"
@@ -152,6 +160,7 @@
 #include "ngraph/pass/fused_op_decomposition.hpp"
 #include "ngraph/pass/get_output_element_elimination.hpp"
 #include "ngraph/pass/implicit_broadcast_elimination.hpp"
+#include "ngraph/pass/in_place_elementwise.hpp"
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
@@ -161,6 +170,8 @@
 #include "ngraph/pass/propagate_cacheability.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
 #include "ngraph/pass/reshape_sinking.hpp"
+#include "ngraph/pass/share_constants.hpp"
+#include "ngraph/pass/subgraph_constant_folding.hpp"
 #include "ngraph/pass/zero_dim_tensor_elimination.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
@@ -172,6 +183,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/cpu_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/cpu_visualize_tree.hpp"
@@ -261,6 +273,16 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
 
 runtime::cpu::CPU_ExternalFunction::~CPU_ExternalFunction()
 {
+    if (m_scheduler && std::getenv("NGRAPH_CPU_SCHEDULER_STATS") != nullptr)
+    {
+        auto statistics = m_scheduler->get_statistics();
+        NGRAPH_INFO << m_function_name << ": " << statistics.task_count << " kernels in "
+                    << statistics.cluster_count << " clusters on "
+                    << m_scheduler->get_thread_count() << " threads, critical path "
+                    << statistics.critical_path_cost << " of " << statistics.total_cost << ", "
+                    << statistics.achieved_concurrency << " kernels running on average over "
+                    << statistics.run_count << " calls";
+    }
     for (auto state : m_states)
     {
         delete state;
@@ -273,6 +295,22 @@ public:
     StaticInitializers(string directory) { ngraph::file_util::remove_directory(directory); }
 };
 
+#ifdef _OPENMP
+// Sets the OpenMP thread count of the calling thread and restores it on destruction
+class OMPThreadCount
+{
+public:
+    OMPThreadCount(int thread_count)
+        : m_previous(omp_get_max_threads())
+    {
+        omp_set_num_threads(thread_count);
+    }
+    ~OMPThreadCount() { omp_set_num_threads(m_previous); }
+private:
+    int m_previous;
+};
+#endif
+
 #if !defined(NGRAPH_DEX_ONLY)
 
 static const string s_output_dir = "cpu_codegen";
@@ -533,6 +571,7 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
         R"(
 #include <cmath>
 #include <fstream>
+#include <sstream>
 #include <mkldnn.hpp>
 #include "ngraph/distributed.hpp"
 #include "ngraph/except.hpp"
@@ -599,7 +638,10 @@ using namespace ngraph::runtime;
     // to register cleanup handlers. We use it, and not atexit(), because
     // atexit() happens too late, when the JIT is no longer alive
 
-    writer << "void *__dso_handle = 0;\n\n";
+    // Shared libraries get theirs from the C runtime
+    writer << "#if !defined(NGRAPH_AOT)\n";
+    writer << "void *__dso_handle = 0;\n";
+    writer << "#endif\n\n";
 
     if (m_emit_timing)
     {
@@ -652,17 +694,21 @@ using namespace ngraph::runtime;
         writer << "\n";
     }
 
+    // Constant data is bound after compilation instead of embedding its address, so that the
+    // code does not change between processes and can be cached
     writer << "// Declare all constants\n";
+    stringstream bind_constants;
     for (shared_ptr<Node> node : ordered_ops)
     {
         ngraph::op::Constant* c = as_type<ngraph::op::Constant>(node.get());
         if (c)
         {
-            m_active_constants.push_back(node);
             shared_ptr<descriptor::Tensor> tv = node->get_outputs()[0].get_tensor_ptr();
             string type = tv->get_element_type().c_type_string();
-            writer << "static " << type << "* " << tv->get_name() << " = ((" << type << "*)("
-                   << c->get_data_ptr() << "));\n";
+            writer << "static " << type << "* " << tv->get_name() << ";\n";
+            bind_constants << tv->get_name() << " = static_cast<" << type << "*>(constants["
+                           << m_active_constants.size() << "]);\n";
+            m_active_constants.push_back(node);
 
             auto output_tensor = &node->get_output_tensor();
             auto tensor_set = get_tensor_set(output_tensor);
@@ -676,6 +722,19 @@ using namespace ngraph::runtime;
         }
     }
 
+    writer << "static std::string mkldnn_descriptors;\n";
+    writer << "extern \"C\" void bind_mkldnn_descriptors(const char* data, size_t size)\n";
+    writer << "{\n";
+    writer << "    mkldnn_descriptors.assign(data, size);\n";
+    writer << "}\n\n";
+
+    writer << "extern \"C\" void bind_constants(void** constants)\n";
+    writer << "{\n";
+    writer.indent++;
+    writer << bind_constants.str();
+    writer.indent--;
+    writer << "}\n\n";
+
     generate_class_declarations(writer);
 
     const char* func_params =
@@ -772,7 +831,7 @@ using namespace ngraph::runtime;
         writer << "if (ctx->first_iteration)\n";
         writer.block_begin();
         writer << "// read in memory descriptors and build mkldnn primitives\n";
-        writer << "std::ifstream desc_file (\"" << m_desc_filename << "\", std::ios::binary);\n";
+        writer << "std::istringstream desc_file(mkldnn_descriptors, std::ios::binary);\n";
         writer << "deserialize_memory_descs_and_build_memory(" << m_desc_filename << ", cg_ctx, "
                << to_string(m_mkldnn_emitter->get_mkldnn_descriptors_size()) << ");\n";
         writer.block_end();
@@ -1097,13 +1156,19 @@ using namespace ngraph::runtime;
 
     // TODO: Cleanup and make this a utility function
     string filename = file_util::path_join(s_output_dir, m_function_name + "_codegen.cpp");
-    string code = writer.get_code();
+    m_codegen_source = writer.get_code();
+    const string& code = m_codegen_source;
     runtime::cpu::CPU_ExternalFunction::write_to_file(writer.get_code(), s_output_dir, filename);
 
     m_compiler.reset(new codegen::Compiler());
     m_execution_engine.reset(new codegen::ExecutionEngine());
 
     m_compiler->set_precompiled_header_source(pch_header_source);
+    const auto envCacheDir = std::getenv("NGRAPH_CODEGEN_CACHE_DIR");
+    if (envCacheDir != nullptr)
+    {
+        m_compiler->set_cache_directory(envCacheDir);
+    }
 
     auto codegen_module = m_compiler->compile(code);
 
@@ -1136,6 +1201,33 @@ using namespace ngraph::runtime;
         throw runtime_error("could not find compiled function");
     }
 
+    auto bind_constants_func = m_execution_engine->find_function<void(void**)>("bind_constants");
+    if (bind_constants_func == nullptr)
+    {
+        throw runtime_error("could not find compiled bind constants function");
+    }
+    vector<void*> constant_data;
+    for (auto& node : m_active_constants)
+    {
+        auto c = static_pointer_cast<ngraph::op::Constant>(node);
+        constant_data.push_back(const_cast<void*>(c->get_data_ptr()));
+    }
+    bind_constants_func(constant_data.data());
+
+    if (m_mkldnn_emitter->get_mkldnn_descriptors_size() > 0)
+    {
+        ifstream desc_file(m_desc_filename, ios::binary);
+        m_mkldnn_descriptors.assign(istreambuf_iterator<char>(desc_file),
+                                    istreambuf_iterator<char>());
+    }
+    auto bind_mkldnn_descriptors_func =
+        m_execution_engine->find_function<void(const char*, size_t)>("bind_mkldnn_descriptors");
+    if (bind_mkldnn_descriptors_func == nullptr)
+    {
+        throw runtime_error("could not find compiled bind mkldnn descriptors function");
+    }
+    bind_mkldnn_descriptors_func(m_mkldnn_descriptors.data(), m_mkldnn_descriptors.size());
+
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
     {
@@ -1313,19 +1405,30 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false)
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(ConstantFolding, true, ngraph::pass, GetGlobalCFDispatcherCPU())
+    REGISTER_KNOBBED_PASS(SubgraphConstantFolding, false, ngraph::pass)
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPULayout, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         CommonSubexpressionElimination, true, ngraph::pass, runtime::cpu::get_cse_handlers_map())
+    REGISTER_KNOBBED_PASS(ShareConstants, false, ngraph::pass)
     REGISTER_KNOBBED_PASS(CPUPostLayoutOptimizations, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUConvertLayoutConstantFolding, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUMemoryOptimization, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(GetOutputElementElimination, false, ngraph::pass)
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory())
+    REGISTER_KNOBBED_PASS_WITH_ARGS(
+        InPlaceElementwise, false, ngraph::pass, runtime::cpu::get_annotations_factory())
     bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                         pass_config.get_pass_attribute("ReuseMemory");
+    bool offline_planning =
+        pass_config.get_pass_attribute("CPUMemoryAssignment::OfflineMemoryPlanning") ||
+        pass_config.get_pass_attribute("OfflineMemoryPlanning");
     pass_manager.register_pass<runtime::cpu::pass::CPUMemoryAssignment>(
-        bufferID_to_tensorSets, tensor_to_bufferID, size_t(s_memory_pool_alignment), !reuse_memory);
+        bufferID_to_tensorSets,
+        tensor_to_bufferID,
+        size_t(s_memory_pool_alignment),
+        !reuse_memory,
+        offline_planning);
 
     pass_manager.get_state().set_visualize_tree_ops_map(runtime::cpu::get_visualize_tree_ops_map());
 }
@@ -1435,6 +1538,42 @@ void runtime::cpu::CPU_ExternalFunction::dump_one_kernel(CPU_DebugTracer& debug_
     }
 }
 
+// Rough number of elementary operations of a kernel, used to order and cluster kernels
+static size_t estimate_cost(const Node& node)
+{
+    size_t cost = 1;
+    for (const descriptor::Input& input : node.get_inputs())
+    {
+        cost = max(cost, shape_size(input.get_shape()));
+    }
+    for (const descriptor::Output& output : node.get_outputs())
+    {
+        cost = max(cost, shape_size(output.get_shape()));
+    }
+
+    if (auto dot = as_type<const op::Dot>(&node))
+    {
+        // Every output element is a dot product over the reduction axes
+        const Shape& arg0_shape = dot->get_input_shape(0);
+        size_t reduction_size = 1;
+        for (size_t i = arg0_shape.size() - dot->get_reduction_axes_count(); i < arg0_shape.size();
+             i++)
+        {
+            reduction_size *= arg0_shape[i];
+        }
+        cost = max(cost, shape_size(dot->get_output_shape(0)) * reduction_size);
+    }
+    else if (auto convolution = as_type<const op::Convolution>(&node))
+    {
+        // Every output element reads one filter
+        const Shape& filters_shape = convolution->get_input_shape(1);
+        cost = max(cost,
+                   shape_size(convolution->get_output_shape(0)) * shape_size(filters_shape) /
+                       max<size_t>(filters_shape.at(0), 1));
+    }
+    return cost;
+}
+
 void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_config)
 {
     if (m_is_built)
@@ -1599,6 +1738,33 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+    // Memory spaces seen by the scheduler: the intermediate pool, every function input, every
+    // function output and every constant
+    unordered_map<size_t, size_t> buffer_spaces;
+    for (const auto& p : intermediates_offsets)
+    {
+        buffer_spaces[p.first] = 0;
+    }
+    for (const auto& p : function_input_index_offset)
+    {
+        buffer_spaces[get<0>(p)] = 1 + get<1>(p);
+    }
+    size_t output_spaces = 1 + arg_index;
+    for (const auto& p : function_output_index_offset)
+    {
+        buffer_spaces[get<0>(p)] = output_spaces + get<1>(p);
+    }
+    size_t constant_spaces = output_spaces + m_function->get_output_size();
+    for (const auto& p : constant_tensor_data)
+    {
+        buffer_spaces[p.first] = constant_spaces + p.first;
+    }
+    vector<CPU_Scheduler::Task> scheduler_tasks;
+    vector<vector<CPU_Scheduler::MemoryAccess>> scheduler_accesses;
+    // Kernels with side effects outside of their tensors keep their relative order
+    bool has_ordered_task = false;
+    size_t last_ordered_task = 0;
+
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1714,6 +1880,42 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         enables.emplace_back(enable);
         enable_nodename_list.emplace_back(make_pair(enable, node->get_name()));
 
+        // MKL-DNN kernels share the scratchpad buffer of the runtime context
+        CPU_Scheduler::Task task{
+            {}, estimate_cost(*node), runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node.get())};
+        if (node->has_state() || is_type<op::AllReduce>(node) ||
+            is_type<op::BroadcastDistributed>(node) || is_type<op::Send>(node) ||
+            is_type<op::Recv>(node))
+        {
+            if (has_ordered_task)
+            {
+                task.predecessors.push_back(last_ordered_task);
+            }
+            has_ordered_task = true;
+            last_ordered_task = scheduler_tasks.size();
+        }
+        scheduler_tasks.push_back(task);
+        vector<CPU_Scheduler::MemoryAccess> accesses;
+        auto add_access = [&](const TensorViewWrapper& tvw, bool write) {
+            auto tv = tvw.get_tensor();
+            size_t index = get_buffer_index(tv->get_name());
+            auto space = buffer_spaces.find(index);
+            accesses.push_back({space == buffer_spaces.end() ? constant_spaces + index
+                                                             : space->second,
+                                tv->get_pool_offset(),
+                                tv->get_pool_offset() + tv->size(),
+                                write});
+        };
+        for (const auto& tvw : in)
+        {
+            add_access(tvw, false);
+        }
+        for (const auto& tvw : out)
+        {
+            add_access(tvw, true);
+        }
+        scheduler_accesses.push_back(accesses);
+
         m_perf_counters.emplace_back(node, 0, 0);
     }
 
@@ -1781,6 +1983,19 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // This check ensures we have exactly one functor for Op.
     NGRAPH_CHECK(m_op_attrs.size() == functors.size());
 
+    size_t scheduler_threads = executor::GetCPUExecutor().get_num_thread_pools();
+#if defined(NGRAPH_TBB_ENABLE)
+    if (m_use_tbb)
+    {
+        scheduler_threads = 1;
+    }
+#endif
+    if (scheduler_threads > 1 && !debug_tracer.tracing_is_enabled())
+    {
+        CPU_Scheduler::add_memory_dependencies(scheduler_tasks, scheduler_accesses);
+        m_scheduler.reset(new CPU_Scheduler(scheduler_tasks, scheduler_threads, 1 << 15));
+    }
+
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
         cpu::Timestamp start_ts, end_ts;
         uint64_t profiler_count = 0;
@@ -1951,6 +2166,66 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 }
             }
 
+            // The scheduler runs whole calls only, so stepping through a debugger stays
+            // sequential. Each worker uses its own executor arena and an even share of the
+            // OpenMP threads, except for MKL-DNN kernels which never overlap with each other.
+            if (m_scheduler && ctx->pc == 0 && ctx->breakpoints.empty())
+            {
+#ifdef _OPENMP
+                int cores = executor::GetCPUExecutor().get_num_cores();
+                int shared_cores =
+                    max(1, cores / static_cast<int>(m_scheduler->get_thread_count()));
+#endif
+                m_scheduler->run([&](size_t index, size_t worker) {
+                    if (enables.at(index)(ctx) || ctx->first_iteration)
+                    {
+                        cpu::Timestamp task_start_ts;
+                        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                        {
+                            task_start_ts = cpu::Clock::now();
+                        }
+#ifdef _OPENMP
+                        // Workers are shared with other calls, so leave their count as it was
+                        OMPThreadCount omp_thread_count(
+                            m_scheduler->get_task(index).exclusive ? cores : shared_cores);
+#endif
+                        CPUExecutionContext ectx{static_cast<int>(worker)};
+                        executor::GetCPUExecutor().execute(functors.at(index), ctx, &ectx);
+                        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                        {
+                            auto task_duration = cpu::Clock::now() - task_start_ts;
+                            if (runtime::cpu::IsTracingEnabled())
+                            {
+                                ctx->op_durations[index] =
+                                    std::chrono::duration_cast<cpu::Timescale>(task_duration)
+                                        .count();
+                            }
+                            if (m_emit_timing)
+                            {
+                                m_perf_counters[index].m_total_microseconds +=
+                                    std::chrono::duration_cast<std::chrono::microseconds>(
+                                        task_duration)
+                                        .count();
+                                m_perf_counters[index].m_call_count++;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        if (runtime::cpu::IsTracingEnabled())
+                        {
+                            ctx->op_durations[index] = 0;
+                        }
+                        if (m_emit_timing)
+                        {
+                            m_perf_counters[index].m_call_count++;
+                        }
+                    }
+                });
+                ctx->pc = functors.size();
+                profiler_count = functors.size();
+            }
+
             for (; ctx->pc < functors.size(); ctx->pc++)
             {
                 auto index = profiler_count++;
@@ -2108,6 +2383,41 @@ const runtime::cpu::LayoutDescriptorPtrs&
     return result_layout_descriptors;
 }
 
+#if !defined(NGRAPH_DEX_ONLY)
+runtime::cpu::AOTModel runtime::cpu::CPU_ExternalFunction::get_aot_model()
+{
+    NGRAPH_CHECK(m_is_compiled && !m_direct_execution,
+                 "Only functions compiled in codegen mode can be exported");
+    NGRAPH_CHECK(m_states.empty(), "Functions with random number state cannot be exported");
+    NGRAPH_CHECK(!m_emit_timing, "Functions with timing enabled cannot be exported");
+
+    AOTModel model;
+    model.function_name = m_function_name;
+    model.source = m_codegen_source;
+    for (auto& node : m_active_constants)
+    {
+        auto c = static_pointer_cast<ngraph::op::Constant>(node);
+        model.constants.emplace_back(c->get_data_ptr(),
+                                     shape_size(c->get_shape()) * c->get_element_type().size());
+    }
+    model.mkldnn_descriptors = m_mkldnn_descriptors;
+    model.memory_buffer_sizes = m_memory_buffer_sizes;
+    model.memory_buffer_alignment = s_memory_pool_alignment;
+    // Callers of the library pass plain buffers, so the interface must not use MKL-DNN layouts
+    for (auto& layout : parameter_layout_descriptors)
+    {
+        NGRAPH_CHECK(layout->is_row_major_layout(), "Exported inputs must be row-major");
+        model.inputs.emplace_back(layout->get_element_type(), layout->get_shape());
+    }
+    for (auto& layout : result_layout_descriptors)
+    {
+        NGRAPH_CHECK(layout->is_row_major_layout(), "Exported outputs must be row-major");
+        model.outputs.emplace_back(layout->get_element_type(), layout->get_shape());
+    }
+    return model;
+}
+#endif
+
 const vector<runtime::PerformanceCounter>& runtime::cpu::CPU_ExternalFunction::get_perf_counters()
 {
 #if !defined(NGRAPH_DEX_ONLY)
@@ -39,9 +39,11 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/cpu/cpu_aot.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_debug_tracer.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
@@ -174,6 +176,10 @@ namespace ngraph
                     return callees;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+#if !defined(NGRAPH_DEX_ONLY)
+                /// \brief Describes the compiled function for build_aot_library
+                AOTModel get_aot_model();
+#endif
                 void write_to_file(const std::string& code,
                                    const std::string& directory,
                                    const std::string& filename);
@@ -226,6 +232,10 @@ namespace ngraph
 
                 std::unique_ptr<codegen::Compiler> m_compiler;
                 std::unique_ptr<codegen::ExecutionEngine> m_execution_engine;
+                /// Generated code, kept for ahead of time compilation
+                std::string m_codegen_source;
+                /// Serialized memory descriptors of the MKL-DNN primitives in the generated code
+                std::string m_mkldnn_descriptors;
 
                 std::map<std::string, size_t> m_name_index_map;
 
@@ -320,6 +330,9 @@ namespace ngraph
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
+                /// Runs independent kernels concurrently in DEX mode when
+                /// NGRAPH_INTER_OP_PARALLELISM is above one and TBB is not used
+                std::unique_ptr<CPU_Scheduler> m_scheduler;
 
                 /// Map each node with mkldnn implementation to its mkldnn primitive creating
                 /// string, deps, mkldnn primitive index, and mkldnn scratchpad size.
@@ -0,0 +1,283 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/cpu/cpu_scheduler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+struct runtime::cpu::CPU_Scheduler::RunState
+{
+    mutex state_mutex;
+    condition_variable changed;
+    // Clusters whose predecessors have all completed, most urgent first. Ties go to the
+    // cluster that comes first in the sequential order.
+    priority_queue<pair<size_t, size_t>> ready;
+    vector<size_t> pending_predecessors;
+    size_t remaining;
+    exception_ptr exception;
+    int64_t busy_nanoseconds{0};
+};
+
+runtime::cpu::CPU_Scheduler::CPU_Scheduler(const vector<Task>& tasks,
+                                           size_t thread_count,
+                                           size_t min_cluster_cost)
+    : m_tasks(tasks)
+    , m_thread_pool(max<size_t>(thread_count, 1))
+{
+    vector<vector<size_t>> successors(m_tasks.size());
+    for (size_t task = 0; task < m_tasks.size(); task++)
+    {
+        auto& predecessors = m_tasks[task].predecessors;
+        sort(predecessors.begin(), predecessors.end());
+        predecessors.erase(unique(predecessors.begin(), predecessors.end()), predecessors.end());
+        for (size_t predecessor : predecessors)
+        {
+            NGRAPH_CHECK(predecessor < task, "Task ", task, " depends on a later task");
+            successors[predecessor].push_back(task);
+        }
+    }
+
+    // Clusters are linear chains: only the first task of a cluster has predecessors outside
+    // of it and only the last one has successors outside of it. Clusters are created in the
+    // sequential order, which keeps them topologically sorted.
+    vector<size_t> cluster_of(m_tasks.size());
+    for (size_t task = 0; task < m_tasks.size(); task++)
+    {
+        const Task& t = m_tasks[task];
+        if (t.predecessors.size() == 1)
+        {
+            size_t predecessor = t.predecessors[0];
+            Cluster& cluster = m_clusters[cluster_of[predecessor]];
+            if (cluster.tasks.back() == predecessor && successors[predecessor].size() == 1 &&
+                (cluster.cost < min_cluster_cost || t.cost < min_cluster_cost))
+            {
+                cluster.tasks.push_back(task);
+                cluster.cost += t.cost;
+                cluster_of[task] = cluster_of[predecessor];
+                continue;
+            }
+        }
+
+        size_t index = m_clusters.size();
+        Cluster cluster;
+        cluster.tasks.push_back(task);
+        cluster.cost = t.cost;
+        cluster.predecessor_count = 0;
+        cluster.priority = 0;
+        for (size_t predecessor : t.predecessors)
+        {
+            auto& predecessor_successors = m_clusters[cluster_of[predecessor]].successors;
+            if (predecessor_successors.empty() || predecessor_successors.back() != index)
+            {
+                predecessor_successors.push_back(index);
+                cluster.predecessor_count++;
+            }
+        }
+        cluster_of[task] = index;
+        m_clusters.push_back(move(cluster));
+    }
+
+    for (size_t index = m_clusters.size(); index-- > 0;)
+    {
+        Cluster& cluster = m_clusters[index];
+        size_t tail = 0;
+        for (size_t successor : cluster.successors)
+        {
+            tail = max(tail, m_clusters[successor].priority);
+        }
+        cluster.priority = cluster.cost + tail;
+    }
+}
+
+void runtime::cpu::CPU_Scheduler::add_memory_dependencies(
+    vector<Task>& tasks, const vector<vector<MemoryAccess>>& accesses)
+{
+    NGRAPH_CHECK(tasks.size() == accesses.size());
+    // Earlier accesses per space. An access is dropped once a later write covers it: anything
+    // that conflicts with it from then on also conflicts with that write, which follows it.
+    unordered_map<size_t, vector<pair<MemoryAccess, size_t>>> previous;
+    for (size_t task = 0; task < tasks.size(); task++)
+    {
+        for (const MemoryAccess& access : accesses[task])
+        {
+            for (const auto& p : previous[access.space])
+            {
+                if (p.second != task && (access.write || p.first.write) &&
+                    access.begin < p.first.end && p.first.begin < access.end)
+                {
+                    tasks[task].predecessors.push_back(p.second);
+                }
+            }
+        }
+        for (const MemoryAccess& access : accesses[task])
+        {
+            if (access.begin == access.end)
+            {
+                continue;
+            }
+            auto& space = previous[access.space];
+            if (access.write)
+            {
+                space.erase(remove_if(space.begin(),
+                                      space.end(),
+                                      [&access](const pair<MemoryAccess, size_t>& p) {
+                                          return access.begin <= p.first.begin &&
+                                                 p.first.end <= access.end;
+                                      }),
+                            space.end());
+            }
+            space.push_back({access, task});
+        }
+    }
+}
+
+void runtime::cpu::CPU_Scheduler::run(const function<void(size_t task, size_t worker)>& execute)
+{
+    unique_lock<mutex> run_lock(m_run_mutex, try_to_lock);
+    if (!run_lock.owns_lock() || get_thread_count() == 1 || m_clusters.size() < 2)
+    {
+        for (size_t task = 0; task < m_tasks.size(); task++)
+        {
+            execute(task, 0);
+        }
+        return;
+    }
+
+    RunState state;
+    state.remaining = m_clusters.size();
+    for (size_t index = 0; index < m_clusters.size(); index++)
+    {
+        const Cluster& cluster = m_clusters[index];
+        state.pending_predecessors.push_back(cluster.predecessor_count);
+        if (cluster.predecessor_count == 0)
+        {
+            state.ready.push({cluster.priority, m_clusters.size() - index});
+        }
+    }
+
+    auto start = chrono::steady_clock::now();
+    size_t workers = get_thread_count();
+    if (!m_thread_pool.try_parallel_for(workers, workers, [&](size_t worker, size_t /* end */) {
+            work(state, worker, execute);
+        }))
+    {
+        work(state, 0, execute);
+    }
+    int64_t wall_nanoseconds =
+        chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+
+    if (state.exception)
+    {
+        rethrow_exception(state.exception);
+    }
+    lock_guard<mutex> lock(m_statistics_mutex);
+    m_run_count++;
+    m_busy_nanoseconds += state.busy_nanoseconds;
+    m_wall_nanoseconds += wall_nanoseconds;
+}
+
+void runtime::cpu::CPU_Scheduler::work(RunState& state,
+                                       size_t worker,
+                                       const function<void(size_t task, size_t worker)>& execute)
+{
+    while (true)
+    {
+        size_t index;
+        {
+            unique_lock<mutex> lock(state.state_mutex);
+            state.changed.wait(lock, [&state]() {
+                return !state.ready.empty() || state.remaining == 0 || state.exception;
+            });
+            if (state.remaining == 0 || state.exception)
+            {
+                return;
+            }
+            index = m_clusters.size() - state.ready.top().second;
+            state.ready.pop();
+        }
+
+        const Cluster& cluster = m_clusters[index];
+        auto start = chrono::steady_clock::now();
+        try
+        {
+            for (size_t task : cluster.tasks)
+            {
+                if (m_tasks[task].exclusive)
+                {
+                    lock_guard<mutex> exclusive_lock(m_exclusive_mutex);
+                    execute(task, worker);
+                }
+                else
+                {
+                    execute(task, worker);
+                }
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(state.state_mutex);
+            if (!state.exception)
+            {
+                state.exception = current_exception();
+            }
+            state.changed.notify_all();
+            return;
+        }
+        int64_t busy_nanoseconds =
+            chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start)
+                .count();
+
+        lock_guard<mutex> lock(state.state_mutex);
+        state.busy_nanoseconds += busy_nanoseconds;
+        state.remaining--;
+        for (size_t successor : cluster.successors)
+        {
+            if (--state.pending_predecessors[successor] == 0)
+            {
+                state.ready.push({m_clusters[successor].priority, m_clusters.size() - successor});
+            }
+        }
+        state.changed.notify_all();
+    }
+}
+
+runtime::cpu::CPU_Scheduler::Statistics runtime::cpu::CPU_Scheduler::get_statistics() const
+{
+    Statistics statistics;
+    statistics.task_count = m_tasks.size();
+    statistics.cluster_count = m_clusters.size();
+    statistics.total_cost = 0;
+    statistics.critical_path_cost = 0;
+    for (const Cluster& cluster : m_clusters)
+    {
+        statistics.total_cost += cluster.cost;
+        statistics.critical_path_cost = max(statistics.critical_path_cost, cluster.priority);
+    }
+    lock_guard<mutex> lock(m_statistics_mutex);
+    statistics.run_count = m_run_count;
+    statistics.achieved_concurrency =
+        m_wall_nanoseconds == 0 ? 0 : static_cast<double>(m_busy_nanoseconds) / m_wall_nanoseconds;
+    return statistics;
+}
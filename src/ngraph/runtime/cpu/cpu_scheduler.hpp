@@ -0,0 +1,135 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "cpu_backend_visibility.h"
+#include "ngraph/runtime/thread_pool.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Runs the kernels of a DEX function on several threads in an order allowed
+            ///        by the dependencies between them.
+            ///
+            /// Chains of cheap kernels are fused into clusters that a thread runs back to back so
+            /// the dispatch cost is paid once per cluster. Ready clusters are started in order of
+            /// the longest remaining path to the end of the function, so the critical path is
+            /// never waiting behind work that can be overlapped with it.
+            class CPU_BACKEND_API CPU_Scheduler
+            {
+            public:
+                /// \brief One kernel, listed in the sequential execution order
+                struct Task
+                {
+                    /// Earlier tasks which must complete before this one starts
+                    std::vector<size_t> predecessors;
+                    /// Estimated number of elementary operations
+                    size_t cost;
+                    /// Exclusive tasks share state and never run at the same time as each other
+                    bool exclusive;
+                };
+
+                /// \brief A byte range of one memory space read or written by a task
+                struct MemoryAccess
+                {
+                    size_t space;
+                    size_t begin;
+                    size_t end;
+                    bool write;
+                };
+
+                struct Statistics
+                {
+                    size_t task_count;
+                    size_t cluster_count;
+                    size_t total_cost;
+                    /// Cost of the most expensive dependency chain
+                    size_t critical_path_cost;
+                    size_t run_count;
+                    /// Time spent in tasks divided by the wall time of the runs, i.e. the
+                    /// average number of tasks that ran at the same time
+                    double achieved_concurrency;
+                };
+
+                /// \param tasks Kernels in the sequential execution order
+                /// \param thread_count Threads running tasks, including the caller of run()
+                /// \param min_cluster_cost Tasks cheaper than this are fused with their only
+                ///        predecessor or successor
+                CPU_Scheduler(const std::vector<Task>& tasks,
+                              size_t thread_count,
+                              size_t min_cluster_cost);
+
+                /// \brief Makes every task depend on the earlier tasks that write memory it
+                ///        accesses and on the earlier tasks that access memory it writes, which
+                ///        orders tasks correctly even when buffers are reused or aliased.
+                /// \param accesses The memory accessed by each task
+                static void
+                    add_memory_dependencies(std::vector<Task>& tasks,
+                                            const std::vector<std::vector<MemoryAccess>>& accesses);
+
+                /// \brief Calls execute(task, worker) once for every task, where worker is less
+                ///        than get_thread_count() and identifies the thread running the task.
+                ///        Runs the tasks in order on the calling thread while another run is in
+                ///        progress. Rethrows the first exception thrown by execute.
+                void run(const std::function<void(size_t task, size_t worker)>& execute);
+
+                size_t get_thread_count() const { return m_thread_pool.get_thread_count(); }
+                const Task& get_task(size_t task) const { return m_tasks.at(task); }
+                Statistics get_statistics() const;
+
+            private:
+                struct Cluster
+                {
+                    std::vector<size_t> tasks;
+                    std::vector<size_t> successors;
+                    size_t predecessor_count;
+                    size_t cost;
+                    /// Cost of the most expensive path from the start of this cluster to the
+                    /// end of the function
+                    size_t priority;
+                };
+
+                struct RunState;
+
+                void work(RunState& state,
+                          size_t worker,
+                          const std::function<void(size_t task, size_t worker)>& execute);
+
+                std::vector<Task> m_tasks;
+                std::vector<Cluster> m_clusters;
+                ThreadPool m_thread_pool;
+                std::mutex m_run_mutex;
+                std::mutex m_exclusive_mutex;
+
+                mutable std::mutex m_statistics_mutex;
+                size_t m_run_count{0};
+                int64_t m_busy_nanoseconds{0};
+                int64_t m_wall_nanoseconds{0};
+            };
+        }
+    }
+}
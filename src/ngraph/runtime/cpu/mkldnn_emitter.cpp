@@ -1544,8 +1544,13 @@ size_t MKLDNNEmitter::query_scratchpad_convolution_forward(
     const mkldnn::convolution_forward::desc& desc, mkldnn::primitive_attr& attr)
 {
     attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
-    auto pd = mkldnn::convolution_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
-    GET_SIZE
+    // Creates the primitive descriptor that building the primitive reuses
+    mkldnn::memory::desc scratchpad_md =
+        MKLDNNPrimitiveCache::get().get_scratchpad_desc<mkldnn::convolution_forward>(
+            desc, attr, executor::global_cpu_engine);
+    size_t size = scratchpad_md.get_size();
+    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;
+    return size;
 }
 
 size_t MKLDNNEmitter::query_scratchpad_convolution_backward_data(
@@ -1603,9 +1608,12 @@ size_t MKLDNNEmitter::query_scratchpad_ip_forward(const mkldnn::inner_product_fo
                                                   mkldnn::primitive_attr& attr)
 {
     attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
-    auto pd =
-        mkldnn::inner_product_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
-    GET_SIZE
+    mkldnn::memory::desc scratchpad_md =
+        MKLDNNPrimitiveCache::get().get_scratchpad_desc<mkldnn::inner_product_forward>(
+            desc, attr, executor::global_cpu_engine);
+    size_t size = scratchpad_md.get_size();
+    m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;
+    return size;
 }
 
 size_t MKLDNNEmitter::query_scratchpad_reorder(const mkldnn::memory::desc& input_desc,
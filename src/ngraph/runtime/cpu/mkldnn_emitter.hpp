@@ -49,6 +49,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
@@ -1372,12 +1373,12 @@ namespace ngraph
                     mkldnn_memories[results_idx] =
                         new mkldnn::memory(desc.data.dst_desc, engine, nullptr);
 
-                    auto conv_pd = mkldnn::convolution_forward::primitive_desc(desc, attr, engine);
-                    mkldnn_scratchpad_mds[conv_idx] =
-                        new mkldnn::memory::desc(conv_pd.scratchpad_desc());
-
-                    mkldnn::primitive* prim = new mkldnn::convolution_forward(conv_pd);
-                    mkldnn_primitives[conv_idx] = prim;
+                    auto& cache = MKLDNNPrimitiveCache::get();
+                    mkldnn_scratchpad_mds[conv_idx] = new mkldnn::memory::desc(
+                        cache.get_scratchpad_desc<mkldnn::convolution_forward>(
+                            desc, attr, engine));
+                    mkldnn_primitives[conv_idx] = new mkldnn::primitive(
+                        cache.get_primitive<mkldnn::convolution_forward>(desc, attr, engine));
                 }
 
                 template <bool with_bias>
@@ -1412,12 +1413,12 @@ namespace ngraph
                     mkldnn_memories[results_idx] =
                         new mkldnn::memory(desc.data.dst_desc, engine, nullptr);
 
-                    auto ip_pd = mkldnn::inner_product_forward::primitive_desc(desc, attr, engine);
-                    mkldnn_scratchpad_mds[ip_idx] =
-                        new mkldnn::memory::desc(ip_pd.scratchpad_desc());
-
-                    mkldnn::primitive* prim = new mkldnn::inner_product_forward(ip_pd);
-                    mkldnn_primitives[ip_idx] = prim;
+                    auto& cache = MKLDNNPrimitiveCache::get();
+                    mkldnn_scratchpad_mds[ip_idx] = new mkldnn::memory::desc(
+                        cache.get_scratchpad_desc<mkldnn::inner_product_forward>(
+                            desc, attr, engine));
+                    mkldnn_primitives[ip_idx] = new mkldnn::primitive(
+                        cache.get_primitive<mkldnn::inner_product_forward>(desc, attr, engine));
                 }
 
                 size_t query_scratchpad_sum(const mkldnn::sum::primitive_desc);
@@ -0,0 +1,186 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#if MKLDNN_VERSION_MAJOR >= 1
+
+static const size_t s_default_capacity = 1024;
+
+template <typename T>
+static void append_value(string& key, const T& value)
+{
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+runtime::cpu::MKLDNNPrimitiveCache& runtime::cpu::MKLDNNPrimitiveCache::get()
+{
+    static MKLDNNPrimitiveCache s_cache;
+    return s_cache;
+}
+
+runtime::cpu::MKLDNNPrimitiveCache::MKLDNNPrimitiveCache()
+{
+    const char* env = getenv("NGRAPH_CPU_MKLDNN_PRIMITIVE_CACHE");
+    m_enabled = env == nullptr || strcmp(env, "0") != 0;
+    const char* env_capacity = getenv("NGRAPH_CPU_MKLDNN_PRIMITIVE_CACHE_CAPACITY");
+    m_capacity = env_capacity == nullptr ? s_default_capacity : strtoul(env_capacity, nullptr, 10);
+}
+
+bool runtime::cpu::MKLDNNPrimitiveCache::append_key(string& key,
+                                                    const mkldnn::primitive_attr& attr,
+                                                    const mkldnn::engine& engine)
+{
+    append_value(key, engine.get_kind());
+    append_value(key, engine.get());
+    append_value(key, attr.get_scratchpad_mode());
+
+    int mask = 0;
+    vector<float> scales;
+    attr.get_output_scales(mask, scales);
+    append_value(key, mask);
+    append_value(key, scales.size());
+    key.append(reinterpret_cast<const char*>(scales.data()), scales.size() * sizeof(float));
+
+    mkldnn::post_ops ops = attr.get_post_ops();
+    append_value(key, ops.len());
+    for (int i = 0; i < ops.len(); i++)
+    {
+        auto kind = ops.kind(i);
+        append_value(key, kind);
+        if (kind == mkldnn::primitive::kind::sum)
+        {
+            float scale;
+            ops.get_params_sum(i, scale);
+            append_value(key, scale);
+        }
+        else if (kind == mkldnn::primitive::kind::eltwise)
+        {
+            float scale, alpha, beta;
+            mkldnn::algorithm algorithm;
+            ops.get_params_eltwise(i, scale, algorithm, alpha, beta);
+            append_value(key, scale);
+            append_value(key, algorithm);
+            append_value(key, alpha);
+            append_value(key, beta);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+shared_ptr<runtime::cpu::MKLDNNPrimitiveCache::Entry>
+    runtime::cpu::MKLDNNPrimitiveCache::lookup(const string& key)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+        return nullptr;
+    }
+    m_hits++;
+    m_recent.splice(m_recent.begin(), m_recent, it->second.second);
+    return it->second.first;
+}
+
+shared_ptr<runtime::cpu::MKLDNNPrimitiveCache::Entry>
+    runtime::cpu::MKLDNNPrimitiveCache::insert(const string& key, shared_ptr<Entry> entry)
+{
+    lock_guard<mutex> lock(m_mutex);
+    // Another thread may have created the same entry meanwhile
+    auto it = m_entries.find(key);
+    if (it != m_entries.end())
+    {
+        return it->second.first;
+    }
+    m_recent.push_front(key);
+    m_entries.emplace(key, make_pair(entry, m_recent.begin()));
+    evict();
+    return entry;
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::evict()
+{
+    while (m_entries.size() > m_capacity)
+    {
+        m_entries.erase(m_recent.back());
+        m_recent.pop_back();
+        m_evictions++;
+    }
+}
+
+mkldnn::primitive
+    runtime::cpu::MKLDNNPrimitiveCache::get_primitive(const shared_ptr<Entry>& entry)
+{
+    lock_guard<mutex> lock(entry->mutex);
+    if (entry->create)
+    {
+        entry->primitive = entry->create();
+        entry->create = nullptr;
+        m_primitive_misses++;
+    }
+    else
+    {
+        m_primitive_hits++;
+    }
+    return entry->primitive;
+}
+
+runtime::cpu::MKLDNNPrimitiveCacheStatistics
+    runtime::cpu::MKLDNNPrimitiveCache::get_statistics() const
+{
+    MKLDNNPrimitiveCacheStatistics statistics;
+    statistics.hits = m_hits;
+    statistics.misses = m_misses;
+    statistics.primitive_hits = m_primitive_hits;
+    statistics.primitive_misses = m_primitive_misses;
+    lock_guard<mutex> lock(m_mutex);
+    statistics.entries = m_entries.size();
+    statistics.evictions = m_evictions;
+    return statistics;
+}
+
+size_t runtime::cpu::MKLDNNPrimitiveCache::get_capacity() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::set_capacity(size_t capacity)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_capacity = capacity;
+    evict();
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::clear()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_entries.clear();
+    m_recent.clear();
+}
+
+#endif
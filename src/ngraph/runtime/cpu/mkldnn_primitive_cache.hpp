@@ -0,0 +1,177 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Counters describing the use of the MKL-DNN primitive cache
+            struct MKLDNNPrimitiveCacheStatistics
+            {
+                /// Primitive descriptor requests served from the cache
+                size_t hits = 0;
+                /// Primitive descriptor requests which created a primitive descriptor
+                size_t misses = 0;
+                /// Primitive requests served by a primitive created earlier
+                size_t primitive_hits = 0;
+                /// Primitives created
+                size_t primitive_misses = 0;
+                /// Number of cached primitive descriptors
+                size_t entries = 0;
+                /// Entries dropped to stay within the capacity
+                size_t evictions = 0;
+            };
+
+#if MKLDNN_VERSION_MAJOR >= 1
+            /// \brief Process wide cache of MKL-DNN primitive descriptors and primitives.
+            ///
+            /// Entries are keyed by the primitive type, the operation descriptor, the attributes
+            /// and the engine. Functions compiled with the same convolution or inner product
+            /// configuration share the primitive descriptor created while compiling and the
+            /// primitive, whose kernel is generated on first execution. Primitives use a user
+            /// provided scratchpad, so one primitive can run on several contexts at a time.
+            ///
+            /// The cache holds at most get_capacity() entries and drops the least recently used
+            /// ones beyond that. Executables keep the primitives they use, so dropping an entry
+            /// only stops later compilations from sharing it.
+            ///
+            /// Setting NGRAPH_CPU_MKLDNN_PRIMITIVE_CACHE to 0 disables sharing, and
+            /// NGRAPH_CPU_MKLDNN_PRIMITIVE_CACHE_CAPACITY sets the capacity.
+            class CPU_BACKEND_API MKLDNNPrimitiveCache
+            {
+            public:
+                static MKLDNNPrimitiveCache& get();
+
+                /// \brief Returns the scratchpad descriptor of the primitive of type OP for desc
+                template <typename OP>
+                mkldnn::memory::desc get_scratchpad_desc(const typename OP::desc& desc,
+                                                         const mkldnn::primitive_attr& attr,
+                                                         const mkldnn::engine& engine)
+                {
+                    return find<OP>(desc, attr, engine)->scratchpad_desc;
+                }
+
+                /// \brief Returns the primitive of type OP for desc, creating it on first use
+                template <typename OP>
+                mkldnn::primitive get_primitive(const typename OP::desc& desc,
+                                                const mkldnn::primitive_attr& attr,
+                                                const mkldnn::engine& engine)
+                {
+                    return get_primitive(find<OP>(desc, attr, engine));
+                }
+
+                MKLDNNPrimitiveCacheStatistics get_statistics() const;
+
+                size_t get_capacity() const;
+                /// \brief Sets the maximum number of entries, dropping the least recently used
+                ///        ones beyond it
+                void set_capacity(size_t capacity);
+
+                /// \brief Drops all entries. Primitives in use stay alive until released.
+                void clear();
+
+            private:
+                struct Entry
+                {
+                    mkldnn::memory::desc scratchpad_desc;
+                    /// Creates the primitive from the primitive descriptor, reset once it ran
+                    std::function<mkldnn::primitive()> create;
+                    mkldnn::primitive primitive;
+                    /// Serializes generating the kernel of this entry only
+                    std::mutex mutex;
+                };
+
+                MKLDNNPrimitiveCache();
+
+                /// \brief Appends the attributes and engine to key. Returns false for attributes
+                ///        the key cannot represent, which are not cached.
+                static bool append_key(std::string& key,
+                                       const mkldnn::primitive_attr& attr,
+                                       const mkldnn::engine& engine);
+
+                /// \brief Drops the least recently used entries beyond the capacity, called with
+                ///        m_mutex held
+                void evict();
+                std::shared_ptr<Entry> lookup(const std::string& key);
+                std::shared_ptr<Entry> insert(const std::string& key, std::shared_ptr<Entry> entry);
+                mkldnn::primitive get_primitive(const std::shared_ptr<Entry>& entry);
+
+                template <typename OP>
+                std::shared_ptr<Entry> find(const typename OP::desc& desc,
+                                            const mkldnn::primitive_attr& attr,
+                                            const mkldnn::engine& engine)
+                {
+                    // Equal bytes mean equal descriptors. MKL-DNN value-initializes descriptors
+                    // before filling them in, so the unused dimensions and the padding are zero
+                    // and equal descriptors also have equal bytes. Without that, equal
+                    // descriptors would only miss the cache, never share a wrong primitive.
+                    std::string key = typeid(OP).name();
+                    key.append(reinterpret_cast<const char*>(&desc.data), sizeof(desc.data));
+                    bool cacheable = m_enabled && append_key(key, attr, engine);
+                    if (cacheable)
+                    {
+                        auto entry = lookup(key);
+                        if (entry)
+                        {
+                            return entry;
+                        }
+                    }
+
+                    auto pd = typename OP::primitive_desc(desc, attr, engine);
+                    auto entry = std::make_shared<Entry>();
+                    entry->scratchpad_desc = pd.scratchpad_desc();
+                    entry->create = [pd]() -> mkldnn::primitive { return OP(pd); };
+                    m_misses++;
+                    return cacheable ? insert(key, entry) : entry;
+                }
+
+                bool m_enabled;
+                mutable std::mutex m_mutex;
+                size_t m_capacity;
+                /// Keys from the most to the least recently used
+                std::list<std::string> m_recent;
+                std::unordered_map<
+                    std::string,
+                    std::pair<std::shared_ptr<Entry>, std::list<std::string>::iterator>>
+                    m_entries;
+                std::atomic<size_t> m_hits{0};
+                std::atomic<size_t> m_misses{0};
+                std::atomic<size_t> m_primitive_hits{0};
+                std::atomic<size_t> m_primitive_misses{0};
+                size_t m_evictions = 0;
+            };
+#endif
+        }
+    }
+}
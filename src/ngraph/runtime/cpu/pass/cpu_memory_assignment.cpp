@@ -36,9 +36,11 @@ runtime::cpu::pass::CPUMemoryAssignment::CPUMemoryAssignment(
         bufferID_to_tensorSets,
     unordered_map<descriptor::Tensor*, size_t>& tensor_to_bufferID,
     size_t alignment,
-    bool disable_memory_sharing)
+    bool disable_memory_sharing,
+    bool offline_planning)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_offline_planning(offline_planning)
     , m_bufferID_to_tensorSets(bufferID_to_tensorSets)
     , m_tensor_to_bufferID(tensor_to_bufferID)
 {
@@ -628,7 +630,18 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
     // memory assignment using liveness analysis result
 
     // memory manager for non-cacheable ops, memory allocation will be freed when not longer in use
-    ngraph::pass::MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    auto scheme = ngraph::pass::MemoryManager::allocation_scheme::FIRST_FIT;
+    if (m_disable_memory_sharing)
+    {
+        scheme = ngraph::pass::MemoryManager::allocation_scheme::NO_REUSE;
+    }
+    else if (m_offline_planning)
+    {
+        scheme = ngraph::pass::MemoryManager::allocation_scheme::OFFLINE;
+    }
+    ngraph::pass::MemoryManager mm(m_alignment, scheme);
+    // tensors holding offsets from mm, remapped once an offline plan is made
+    unordered_set<descriptor::Tensor*> mm_tensors;
     // memory manager for cacheable ops, memory allocation will never be freed
     ngraph::pass::MemoryManager mm_caching(m_alignment, true);
 
@@ -756,9 +769,14 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                     // do not combine those two sets.
                     // change the label of output tensor set to that of input tensor set
                     output_buffer_it->second.first = input_buffer_it->second.first;
+                    bool from_mm = mm_tensors.count(input_tensor) != 0;
                     for (auto& ele_t : output_set)
                     {
                         ele_t->set_pool_offset(offset);
+                        if (from_mm)
+                        {
+                            mm_tensors.insert(ele_t);
+                        }
                     }
                 }
             }
@@ -783,7 +801,8 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                     size = e->size();
                 }
             }
-            if (m_tensor_caching.count(tensor) != 0)
+            bool cacheable = m_tensor_caching.count(tensor) != 0;
+            if (cacheable)
             {
                 offset = mm_caching.allocate(size);
             }
@@ -795,6 +814,14 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
             for (auto& e : tensor_set)
             {
                 e->set_pool_offset(offset);
+                if (cacheable)
+                {
+                    mm_tensors.erase(e);
+                }
+                else
+                {
+                    mm_tensors.insert(e);
+                }
             }
         }
 
@@ -816,6 +843,16 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
+    if (scheme == ngraph::pass::MemoryManager::allocation_scheme::OFFLINE)
+    {
+        for (auto tensor : mm_tensors)
+        {
+            tensor->set_pool_offset(mm.get_planned_offset(tensor->get_pool_offset()));
+        }
+        NGRAPH_DEBUG << "cpu_memory_assignment: offline plan for mm is " << mm.max_allocated()
+                     << ", lower bound " << mm.get_lower_bound();
+    }
+
     // update offsets in concat and slice tensors set.
     // In place concatenation optimization
     process_in_place_concat(ops);
@@ -45,7 +45,8 @@ public:
         std::unordered_map<size_t, std::pair<TensorRole, std::unordered_set<descriptor::Tensor*>>>&,
         std::unordered_map<descriptor::Tensor*, size_t>&,
         size_t alignment = 1,
-        bool disable_memory_sharing = false);
+        bool disable_memory_sharing = false,
+        bool offline_planning = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
 private:
@@ -71,6 +72,7 @@ private:
 
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    bool m_offline_planning;
     std::set<descriptor::Tensor*> m_tensor_caching;
     std::unordered_map<size_t,
                        std::pair<ngraph::TensorRole, std::unordered_set<descriptor::Tensor*>>>&
@@ -358,7 +358,7 @@ extern "C" void destroy_cg_ctx(CPURuntimeContextCG* cg_ctx)
 }
 
 static void
-	deserialize_memory_descs_and_build_memory(std::ifstream& desc_file,
+	deserialize_memory_descs_and_build_memory(std::istream& desc_file,
                                               CPURuntimeContextCG* cg_ctx,
                                               size_t descs_count)
 {
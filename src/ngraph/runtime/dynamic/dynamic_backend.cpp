@@ -14,8 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
 #include "ngraph/runtime/dynamic/dynamic_backend.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/convolution.hpp"
@@ -32,6 +39,8 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/opset0_downgrade.hpp"
 #include "ngraph/pass/shape_relevance.hpp"
+#include "ngraph/pass/share_constants.hpp"
+#include "ngraph/serializer.hpp"
 #include "ngraph/specialize_function.hpp"
 #include "ngraph/util.hpp"
 
@@ -66,8 +75,76 @@ shared_ptr<runtime::Executable>
     runtime::dynamic::DynamicBackend::compile(shared_ptr<Function> function,
                                               bool enable_performance_collection)
 {
-    return make_shared<runtime::dynamic::DynamicExecutable>(
+    auto exec = make_shared<runtime::dynamic::DynamicExecutable>(
         function, m_wrapped_backend, enable_performance_collection);
+    exec->set_shape_buckets(m_shape_buckets);
+    exec->set_cache_directory(m_cache_directory);
+    if (m_cache_max_entries >= 0)
+    {
+        exec->get_cache()->set_max_entries(m_cache_max_entries);
+    }
+    if (m_cache_max_bytes >= 0)
+    {
+        exec->get_cache()->set_max_bytes(m_cache_max_bytes);
+    }
+    return exec;
+}
+
+bool runtime::dynamic::DynamicBackend::set_config(const map<string, string>& config,
+                                                  string& error)
+{
+    map<string, string> wrapped_config;
+    error = "";
+    auto parse_limit = [](const pair<const string, string>& entry) {
+        int64_t limit = parse_string<int64_t>(entry.second);
+        if (limit < 0)
+        {
+            throw ngraph_error(entry.first + " must not be negative");
+        }
+        return limit;
+    };
+    try
+    {
+        for (auto& entry : config)
+        {
+            if (entry.first == "shape_buckets")
+            {
+                vector<size_t> buckets;
+                for (const string& bucket : split(entry.second, ','))
+                {
+                    buckets.push_back(parse_string<size_t>(bucket));
+                }
+                if (!is_sorted(buckets.begin(), buckets.end()))
+                {
+                    error = "shape_buckets must be in ascending order";
+                    return false;
+                }
+                m_shape_buckets = buckets;
+            }
+            else if (entry.first == "cache_max_entries")
+            {
+                m_cache_max_entries = parse_limit(entry);
+            }
+            else if (entry.first == "cache_max_bytes")
+            {
+                m_cache_max_bytes = parse_limit(entry);
+            }
+            else if (entry.first == "cache_dir")
+            {
+                m_cache_directory = entry.second;
+            }
+            else
+            {
+                wrapped_config.insert(entry);
+            }
+        }
+    }
+    catch (const exception& e)
+    {
+        error = e.what();
+        return false;
+    }
+    return wrapped_config.empty() || m_wrapped_backend->set_config(wrapped_config, error);
 }
 
 runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrapped_function,
@@ -82,6 +159,32 @@ runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrap
     passes.run_passes(m_wrapped_function);
 
     set_parameters_and_results(*wrapped_function);
+
+    // Only a dynamic leading dimension can be padded to a bucket
+    for (auto& param : get_parameters())
+    {
+        const PartialShape& shape = param->get_output_partial_shape(0);
+        m_bucketed_inputs.push_back(!param->is_relevant_to_shapes() && shape.rank().is_static() &&
+                                    static_cast<size_t>(shape.rank()) > 0 &&
+                                    shape[0].is_dynamic());
+    }
+    for (auto& result : get_results())
+    {
+        const PartialShape& shape = result->get_output_partial_shape(0);
+        m_bucketed_outputs.push_back(shape.rank().is_static() &&
+                                     static_cast<size_t>(shape.rank()) > 0 &&
+                                     shape[0].is_dynamic());
+    }
+}
+
+void runtime::dynamic::DynamicExecutable::set_shape_buckets(const vector<size_t>& shape_buckets)
+{
+    m_shape_buckets = shape_buckets;
+}
+
+void runtime::dynamic::DynamicExecutable::set_cache_directory(const string& directory)
+{
+    m_cache_directory = directory;
 }
 
 // Due to clang++-3.9 bugs, this needs to be a non-static separate function from
@@ -111,212 +214,404 @@ static size_t count_dyn_nodes(const shared_ptr<ngraph::Function>& f)
     return count;
 }
 
+template <typename T>
+static void append_values(runtime::LRUCache::Key& key, const vector<char>& data)
+{
+    const T* values = reinterpret_cast<const T*>(data.data());
+    for (size_t i = 0; i < data.size() / sizeof(T); i++)
+    {
+        key.push_back(static_cast<int64_t>(values[i]));
+    }
+}
+
+// Append the values of a shape relevant tensor to a cache key
+static void append_values(runtime::LRUCache::Key& key, const runtime::Tensor& tensor)
+{
+    vector<char> data(tensor.get_size_in_bytes());
+    tensor.read(data.data(), data.size());
+    switch (tensor.get_element_type())
+    {
+    case element::Type_t::i16: append_values<int16_t>(key, data); break;
+    case element::Type_t::i32: append_values<int32_t>(key, data); break;
+    case element::Type_t::i64: append_values<int64_t>(key, data); break;
+    case element::Type_t::u16: append_values<uint16_t>(key, data); break;
+    case element::Type_t::u32: append_values<uint32_t>(key, data); break;
+    case element::Type_t::u64: append_values<uint64_t>(key, data); break;
+    case element::Type_t::i8: append_values<int8_t>(key, data); break;
+    default: append_values<uint8_t>(key, data); break;
+    }
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_bucket(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs, size_t& leading_dimension) const
+{
+    if (m_shape_buckets.empty())
+    {
+        return 0;
+    }
+    // All bucketed inputs must agree on the leading dimension, otherwise it is not a batch
+    bool found = false;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        if (m_bucketed_inputs[i])
+        {
+            size_t dimension = inputs[i]->get_shape().at(0);
+            if (found && dimension != leading_dimension)
+            {
+                return 0;
+            }
+            leading_dimension = dimension;
+            found = true;
+        }
+    }
+    if (!found)
+    {
+        return 0;
+    }
+    auto it = lower_bound(m_shape_buckets.begin(), m_shape_buckets.end(), leading_dimension);
+    return it == m_shape_buckets.end() ? 0 : *it;
+}
+
 bool runtime::dynamic::DynamicExecutable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
-    // TODO: Get cached executable out if it exists.
-    // We will cache on:
-    // (1) all shapes;
-    // (2) all values of shape-relevant input tensors.
+    NGRAPH_CHECK(m_wrapped_function->get_parameters().size() == inputs.size());
 
-    std::vector<int> merged_input_shapes;
-    std::ostringstream key;
-    size_t loop_count = 0;
+    std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
     for (auto& input : inputs)
     {
-        if (m_wrapped_function->get_parameters()[loop_count]->is_relevant_to_shapes())
+        if (auto dynamic_tensor = std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
         {
-            // Caching on values of Shape relevant inputs
-            int size = input->get_size_in_bytes() / (input->get_element_type().bitwidth() / 8);
-            std::vector<int64_t> data(size);
-            input->read(data.data(), input->get_size_in_bytes());
-            for (int i = 0; i < input->get_element_count(); i++)
-            {
-                merged_input_shapes.emplace_back(data[i]);
-            }
+            NGRAPH_CHECK(dynamic_tensor->has_storage());
+            wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
         }
         else
         {
-            // Caching on all remaining shapes
-            for (int i = 0; i < input->get_shape().size(); i++)
-            {
-                merged_input_shapes.emplace_back(input->get_shape()[i]);
-            }
+            wrapped_inputs.push_back(input);
         }
-        // -1 is the separator.
-        // So if shape of Input 1 = {2, 2, 3, 3} & Input 2 = {4, 5}
-        // the key would be 2, 2, 3, 3, -1, 4, 5, -1
-        merged_input_shapes.emplace_back(-1);
-        loop_count++;
     }
 
-    std::copy(merged_input_shapes.begin(),
-              merged_input_shapes.end(),
-              std::ostream_iterator<int>(key, ", "));
+    size_t leading_dimension = 0;
+    size_t bucket = get_bucket(wrapped_inputs, leading_dimension);
 
-    if (m_lru->is_cached(merged_input_shapes))
+    // We cache on:
+    // (1) all shapes, with the leading dimension rounded up to the bucket;
+    // (2) all values of shape-relevant input tensors.
+    // -1 is the separator.
+    // So if shape of Input 1 = {2, 2, 3, 3} & Input 2 = {4, 5}
+    // the key would be 2, 2, 3, 3, -1, 4, 5, -1
+    LRUCache::Key key;
+    std::vector<element::Type> arg_element_types;
+    std::vector<PartialShape> arg_shapes;
+    for (size_t i = 0; i < wrapped_inputs.size(); i++)
     {
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
+        Shape shape = wrapped_inputs[i]->get_shape();
+        if (bucket != 0 && m_bucketed_inputs[i])
+        {
+            shape[0] = bucket;
+        }
+        arg_element_types.push_back(wrapped_inputs[i]->get_element_type());
+        arg_shapes.push_back(shape);
 
-        std::shared_ptr<Function> clone = m_lru->get_cloned_function(merged_input_shapes);
-        const ResultVector& results = clone->get_results();
-        for (auto& result : results)
+        if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
+        {
+            append_values(key, *wrapped_inputs[i]);
+        }
+        else
         {
-            NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
-                         "Shape staticization failed for result node ",
-                         *result);
+            key.insert(key.end(), shape.begin(), shape.end());
         }
-        NGRAPH_CHECK(results.size() == outputs.size());
+        key.push_back(-1);
+    }
 
-        for (size_t i = 0; i < outputs.size(); i++)
+    shared_ptr<Executable> exec = m_lru->get_cached_entry(key);
+    if (exec == nullptr)
+    {
+        size_t byte_size = 0;
+        exec = load_persisted(key, byte_size);
+        if (exec == nullptr)
         {
-            if (auto dynamic_tensor =
-                    std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
-            {
-                dynamic_tensor->make_storage(results[i]->get_output_element_type(0),
-                                             results[i]->get_output_shape(0));
-                wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
-            }
-            else
-            {
-                wrapped_outputs.push_back(outputs[i]);
-            }
+            exec = compile_specialized(wrapped_inputs, arg_element_types, arg_shapes, byte_size);
+            save_persisted(key, exec, byte_size);
         }
+        // Put compiled executable in the cache.
+        m_lru->add_entry(key, exec, byte_size);
+    }
 
-        return m_lru->get_cached_entry(merged_input_shapes)->call(wrapped_outputs, inputs);
+    // Pad bucketed inputs with zeros
+    std::vector<std::shared_ptr<runtime::Tensor>> call_inputs;
+    for (size_t i = 0; i < wrapped_inputs.size(); i++)
+    {
+        auto& input = wrapped_inputs[i];
+        if (bucket != 0 && bucket != leading_dimension && m_bucketed_inputs[i])
+        {
+            auto padded = m_wrapped_backend->create_tensor(arg_element_types[i],
+                                                           arg_shapes[i].to_shape());
+            AlignedBuffer buffer(padded->get_size_in_bytes(), 64);
+            memset(buffer.get_ptr(), 0, padded->get_size_in_bytes());
+            input->read(buffer.get_ptr(), input->get_size_in_bytes());
+            padded->write(buffer.get_ptr(), padded->get_size_in_bytes());
+            call_inputs.push_back(padded);
+        }
+        else
+        {
+            call_inputs.push_back(input);
+        }
     }
-    else
+
+    const ResultVector& results = exec->get_results();
+    for (auto& result : results)
     {
-        NGRAPH_CHECK(m_wrapped_function->get_parameters().size() == inputs.size());
+        NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
+                     "Shape staticization failed for result node ",
+                     *result);
+    }
+    NGRAPH_CHECK(results.size() == outputs.size());
 
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
-        std::vector<element::Type> arg_element_types;
-        std::vector<PartialShape> arg_shapes;
+    // Outputs with a bucketed leading dimension are computed into a padded tensor and trimmed
+    std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
+    std::vector<std::shared_ptr<runtime::Tensor>> call_outputs;
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        Shape shape = results[i]->get_output_shape(0);
+        bool trim = bucket != 0 && bucket != leading_dimension && m_bucketed_outputs[i] &&
+                    shape.at(0) == bucket;
+        Shape trimmed_shape = shape;
+        if (trim)
+        {
+            trimmed_shape[0] = leading_dimension;
+        }
 
-        std::shared_ptr<Function> clone;
+        if (auto dynamic_tensor =
+                std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
+        {
+            dynamic_tensor->make_storage(results[i]->get_output_element_type(0), trimmed_shape);
+            wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
+        }
+        else
         {
-            // We'll use AlignedBuffers to back the base pointers, storing them in this vector for
-            // RAII
-            // purposes.
-            std::vector<AlignedBuffer> arg_buffers;
-            arg_buffers.reserve(inputs.size());
-            std::vector<void*> arg_value_base_pointers(inputs.size());
+            wrapped_outputs.push_back(outputs[i]);
+        }
 
-            size_t i = 0;
+        if (trim)
+        {
+            call_outputs.push_back(
+                m_wrapped_backend->create_tensor(results[i]->get_output_element_type(0), shape));
+        }
+        else
+        {
+            call_outputs.push_back(wrapped_outputs.back());
+        }
+    }
 
-            for (auto& input : inputs)
-            {
-                if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
-                {
-                    // TODO(amprocte): Move has_storage() to runtime::Tensor?
-                    if (auto dynamic_tensor =
-                            std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-                    {
-                        NGRAPH_CHECK(dynamic_tensor->has_storage());
-                    }
-
-                    arg_buffers.emplace_back(input->get_size_in_bytes(), /*alignment=*/64);
-                    arg_value_base_pointers[i] = arg_buffers.back().get_ptr();
-
-                    // TODO(amprocte): For host-resident tensors we should be able to skip the read,
-                    // but no API for that yet.
-                    input->read(arg_value_base_pointers[i], input->get_size_in_bytes());
-                }
-                else
-                {
-                    arg_value_base_pointers[i] = nullptr;
-                }
+    bool rc = exec->call(call_outputs, call_inputs);
 
-                if (auto dynamic_tensor =
-                        std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-                {
-                    NGRAPH_CHECK(dynamic_tensor->has_storage());
-                    arg_element_types.push_back(
-                        dynamic_tensor->get_wrapped_tensor()->get_element_type());
-                    arg_shapes.push_back(dynamic_tensor->get_wrapped_tensor()->get_shape());
-                    wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
-                }
-                else
-                {
-                    arg_element_types.push_back(input->get_element_type());
-                    arg_shapes.push_back(input->get_shape());
-                    wrapped_inputs.push_back(input);
-                }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (call_outputs[i] != wrapped_outputs[i])
+        {
+            // Row major layout, so the leading rows are a prefix of the padded tensor
+            AlignedBuffer buffer(call_outputs[i]->get_size_in_bytes(), 64);
+            call_outputs[i]->read(buffer.get_ptr(), call_outputs[i]->get_size_in_bytes());
+            wrapped_outputs[i]->write(buffer.get_ptr(), wrapped_outputs[i]->get_size_in_bytes());
+        }
+    }
 
-                i++;
-            }
+    return rc;
+}
+
+shared_ptr<runtime::Executable> runtime::dynamic::DynamicExecutable::compile_specialized(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+    const std::vector<element::Type>& arg_element_types,
+    const std::vector<PartialShape>& arg_shapes,
+    size_t& byte_size)
+{
+    std::shared_ptr<Function> clone;
+    {
+        // We'll use AlignedBuffers to back the base pointers, storing them in this vector for
+        // RAII
+        // purposes.
+        std::vector<AlignedBuffer> arg_buffers;
+        arg_buffers.reserve(inputs.size());
+        std::vector<void*> arg_value_base_pointers(inputs.size());
+
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
+            {
+                arg_buffers.emplace_back(inputs[i]->get_size_in_bytes(), /*alignment=*/64);
+                arg_value_base_pointers[i] = arg_buffers.back().get_ptr();
 
-            clone = specialize_function(
-                m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
+                // TODO(amprocte): For host-resident tensors we should be able to skip the read,
+                // but no API for that yet.
+                inputs[i]->read(arg_value_base_pointers[i], inputs[i]->get_size_in_bytes());
+            }
+            else
+            {
+                arg_value_base_pointers[i] = nullptr;
+            }
         }
 
-        pass::Manager passes;
-        passes.register_pass<pass::ConstantFolding>();
-        passes.register_pass<pass::DynElimination>();
-        passes.register_pass<pass::Opset0Downgrade>(); // Converts dynamic v1 variants to v0 ops
-        passes.set_per_pass_validation(false);
-
-        // FIXME(amprocte): Vile, temporary hack: we need to do repeated rounds of
-        // ConstantFolding/DynElimination until everything that DynElimination is supposed to
-        // eliminate has actually been eliminated. We could do this by monitoring the return values
-        // of the passes (keep iterating until both CF and DE report no changes), but that did not
-        // seem to work so here we are. Probably a better fix is to somehow combine the matchers in
-        // CF
-        // and DE into one pass.
-        size_t num_dyn_nodes_last_pass = std::numeric_limits<size_t>::max();
-
-        while (num_dyn_nodes_last_pass != 0)
-        {
-            passes.run_passes(clone);
-            auto num_dyn_nodes_this_pass = count_dyn_nodes(clone);
+        clone = specialize_function(
+            m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
+    }
 
-            NGRAPH_CHECK(num_dyn_nodes_this_pass < num_dyn_nodes_last_pass,
-                         "Could not eliminate all Dyn nodes (",
-                         num_dyn_nodes_this_pass,
-                         " remaining)");
+    pass::Manager passes;
+    passes.register_pass<pass::ConstantFolding>();
+    passes.register_pass<pass::DynElimination>();
+    passes.register_pass<pass::Opset0Downgrade>(); // Converts dynamic v1 variants to v0 ops
+    passes.set_per_pass_validation(false);
+
+    // FIXME(amprocte): Vile, temporary hack: we need to do repeated rounds of
+    // ConstantFolding/DynElimination until everything that DynElimination is supposed to
+    // eliminate has actually been eliminated. We could do this by monitoring the return values
+    // of the passes (keep iterating until both CF and DE report no changes), but that did not
+    // seem to work so here we are. Probably a better fix is to somehow combine the matchers in
+    // CF
+    // and DE into one pass.
+    size_t num_dyn_nodes_last_pass = std::numeric_limits<size_t>::max();
+
+    while (num_dyn_nodes_last_pass != 0)
+    {
+        passes.run_passes(clone);
+        auto num_dyn_nodes_this_pass = count_dyn_nodes(clone);
 
-            num_dyn_nodes_last_pass = num_dyn_nodes_this_pass;
-        }
+        NGRAPH_CHECK(num_dyn_nodes_this_pass < num_dyn_nodes_last_pass,
+                     "Could not eliminate all Dyn nodes (",
+                     num_dyn_nodes_this_pass,
+                     " remaining)");
 
-        pass::Manager pass_val;
-        pass_val.register_pass<pass::Validate>();
-        pass_val.run_passes(clone);
+        num_dyn_nodes_last_pass = num_dyn_nodes_this_pass;
+    }
 
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
+    pass::Manager pass_val;
+    // Every specialization folds the same weights, keep one copy of each in the process
+    pass_val.register_pass<pass::ShareConstants>();
+    pass_val.register_pass<pass::Validate>();
+    pass_val.run_passes(clone);
 
-        const ResultVector& results = clone->get_results();
-        for (auto& result : results)
+    // Estimate the footprint as the size of all values the specialization computes
+    byte_size = 0;
+    for (auto& node : clone->get_ops())
+    {
+        for (auto& output : node->outputs())
         {
-            NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
-                         "Shape staticization failed for result node ",
-                         *result);
+            byte_size += shape_size(output.get_shape()) * output.get_element_type().size();
         }
-        NGRAPH_CHECK(results.size() == outputs.size());
+    }
+
+    return m_wrapped_backend->compile(clone, m_enable_performance_collection);
+}
+
+static string to_hex(size_t value)
+{
+    ostringstream ss;
+    ss << hex << setw(2 * sizeof(size_t)) << setfill('0') << value;
+    return ss.str();
+}
 
-        for (size_t i = 0; i < outputs.size(); i++)
+string runtime::dynamic::DynamicExecutable::get_persisted_path(const LRUCache::Key& key)
+{
+    if (m_cache_directory.empty())
+    {
+        return "";
+    }
+    if (m_function_fingerprint.empty())
+    {
+        try
         {
-            if (auto dynamic_tensor =
-                    std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
-            {
-                dynamic_tensor->make_storage(results[i]->get_output_element_type(0),
-                                             results[i]->get_output_shape(0));
-                wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
-            }
-            else
-            {
-                wrapped_outputs.push_back(outputs[i]);
-            }
+            // hash_bytes is a fixed FNV-1a, unlike std::hash, so names stay stable across
+            // processes and library builds
+            string serialized = serialize(m_wrapped_function);
+            m_function_fingerprint = to_hex(hash_bytes(serialized.data(), serialized.size())) +
+                                     "-" + to_string(serialized.size());
         }
+        catch (const exception& e)
+        {
+            NGRAPH_WARN << "Not persisting specializations in '" << m_cache_directory
+                        << "': " << e.what();
+            m_cache_directory.clear();
+            return "";
+        }
+    }
+    string full_key = get_persisted_key(key);
+    return file_util::path_join(m_cache_directory,
+                                to_hex(hash_bytes(full_key.data(), full_key.size())));
+}
 
-        auto compiled_executable =
-            m_wrapped_backend->compile(clone, m_enable_performance_collection);
-        // Put compiled executable in the cache.
-        m_lru->add_entry(merged_input_shapes, compiled_executable, clone);
-        auto result = compiled_executable->call(wrapped_outputs, wrapped_inputs);
+string runtime::dynamic::DynamicExecutable::get_persisted_key(const LRUCache::Key& key) const
+{
+    return m_function_fingerprint + "\n" + LRUCache::key_to_string(key);
+}
 
-        return result;
+shared_ptr<runtime::Executable>
+    runtime::dynamic::DynamicExecutable::load_persisted(const LRUCache::Key& key,
+                                                         size_t& byte_size)
+{
+    std::lock_guard<std::mutex> guard(m_persist_mutex);
+    string path = get_persisted_path(key);
+    if (path.empty() || !file_util::exists(path + ".key"))
+    {
+        return nullptr;
+    }
+
+    // The key file is written last. It holds the estimated footprint of the specialization, so
+    // that the cache charges it the same as when it was compiled, followed by the full key,
+    // which guards against collisions in the file name.
+    string contents = file_util::read_file_to_string(path + ".key");
+    size_t separator = contents.find('\n');
+    if (separator == string::npos || contents.substr(separator + 1) != get_persisted_key(key))
+    {
+        return nullptr;
+    }
+
+    shared_ptr<Executable> exec;
+    try
+    {
+        size_t saved_byte_size = parse_string<size_t>(contents.substr(0, separator));
+        ifstream in(path + ".exec", ios::binary);
+        exec = m_wrapped_backend->load(in);
+        byte_size = saved_byte_size;
+        m_persisted_loads++;
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_WARN << "Failed to load '" << path << ".exec': " << e.what();
+        exec = nullptr;
+    }
+    return exec;
+}
+
+void runtime::dynamic::DynamicExecutable::save_persisted(const LRUCache::Key& key,
+                                                         const shared_ptr<Executable>& exec,
+                                                         size_t byte_size)
+{
+    std::lock_guard<std::mutex> guard(m_persist_mutex);
+    string path = get_persisted_path(key);
+    if (path.empty())
+    {
+        return;
+    }
+
+    try
+    {
+        file_util::make_directory(m_cache_directory);
+        {
+            ofstream out(path + ".exec", ios::binary);
+            exec->save(out);
+        }
+        ofstream out(path + ".key", ios::binary);
+        out << byte_size << "\n" << get_persisted_key(key);
+    }
+    catch (const exception& e)
+    {
+        // Most often the wrapped backend cannot save executables at all, so give up on the
+        // first failure instead of retrying on every miss
+        NGRAPH_DEBUG << "Not persisting specializations in '" << m_cache_directory
+                     << "': " << e.what();
+        file_util::remove_file(path + ".exec");
+        m_cache_directory.clear();
     }
 }
 
@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -71,8 +74,28 @@ public:
     std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
                                         bool enable_performance_data = false) override;
 
+    /// \brief Configure the executables compiled afterwards. Unrecognized keys are forwarded
+    ///    to the wrapped backend.
+    ///
+    /// * `shape_buckets`: comma separated, ascending sizes. The dynamic leading dimension of
+    ///   the inputs is padded with zeros to the next bucket so that one specialization serves
+    ///   a range of sizes, outputs are trimmed back. Only valid for functions whose elements
+    ///   along the leading dimension are computed independently, e.g. the batch.
+    /// * `cache_max_entries`: maximum number of cached specializations, 0 for no limit.
+    /// * `cache_max_bytes`: maximum estimated size of the cached specializations, 0 for no
+    ///   limit. Specializations loaded from `cache_dir` are charged the size estimated when
+    ///   they were compiled.
+    /// * `cache_dir`: directory where specializations are saved with Executable::save and
+    ///   loaded from with Backend::load, so they survive a restart. Requires the wrapped
+    ///   backend to support save/load.
+    bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
+
 private:
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
+    std::vector<size_t> m_shape_buckets;
+    int64_t m_cache_max_entries = -1;
+    int64_t m_cache_max_bytes = -1;
+    std::string m_cache_directory;
 };
 
 ///
@@ -98,12 +121,44 @@ public:
     virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+    /// \brief Set the ascending sizes the dynamic leading dimension of the inputs is padded to.
+    ///    See DynamicBackend::set_config.
+    void set_shape_buckets(const std::vector<size_t>& shape_buckets);
+
+    /// \brief Set the directory specializations are persisted in, empty to disable.
+    void set_cache_directory(const std::string& directory);
+
+    /// \returns The cache of compiled specializations, to query statistics or set limits
+    const std::shared_ptr<ngraph::runtime::LRUCache>& get_cache() const { return m_lru; }
+    /// \returns The number of specializations loaded from the cache directory
+    size_t get_persisted_loads() const { return m_persisted_loads; }
 private:
+    size_t get_bucket(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                      size_t& leading_dimension) const;
+    std::shared_ptr<Executable>
+        compile_specialized(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                            const std::vector<element::Type>& arg_element_types,
+                            const std::vector<PartialShape>& arg_shapes,
+                            size_t& byte_size);
+    std::string get_persisted_path(const LRUCache::Key& key);
+    std::string get_persisted_key(const LRUCache::Key& key) const;
+    std::shared_ptr<Executable> load_persisted(const LRUCache::Key& key, size_t& byte_size);
+    void save_persisted(const LRUCache::Key& key,
+                        const std::shared_ptr<Executable>& exec,
+                        size_t byte_size);
+
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
     std::shared_ptr<ngraph::runtime::LRUCache> m_lru =
         std::make_shared<ngraph::runtime::LRUCache>();
     bool m_enable_performance_collection;
+    std::vector<size_t> m_shape_buckets;
+    std::vector<bool> m_bucketed_inputs;
+    std::vector<bool> m_bucketed_outputs;
+    std::string m_cache_directory;
+    std::string m_function_fingerprint;
+    std::mutex m_persist_mutex;
+    std::atomic<size_t> m_persisted_loads{0};
 };
 
 ///
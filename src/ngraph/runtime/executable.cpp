@@ -39,6 +39,35 @@ bool runtime::Executable::call_with_validate(const vector<shared_ptr<runtime::Te
     return call(outputs, inputs);
 }
 
+future<bool>
+    runtime::Executable::begin_execute(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                       const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    vector<pair<runtime::Tensor*, bool>> accesses;
+    for (const shared_ptr<runtime::Tensor>& input : inputs)
+    {
+        accesses.emplace_back(input.get(), false);
+    }
+    for (const shared_ptr<runtime::Tensor>& output : outputs)
+    {
+        accesses.emplace_back(output.get(), true);
+    }
+
+    auto result = make_shared<promise<bool>>();
+    runtime::Tensor::start_async_operation(accesses, [this, outputs, inputs, result]() {
+        try
+        {
+            result->set_value(call(outputs, inputs));
+        }
+        catch (...)
+        {
+            result->set_exception(current_exception());
+            throw;
+        }
+    });
+    return result->get_future();
+}
+
 void runtime::Executable::validate(const vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                    const vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
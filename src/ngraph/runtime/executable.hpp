@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 
 #include "ngraph/function.hpp"
@@ -38,6 +39,8 @@ public:
     Executable();
     virtual ~Executable();
 
+    /// \brief Executes a single iteration of a Function. Does not wait for asynchronous
+    ///    operations on the tensors, which must not be pending (see Tensor::wait_for_write_ready).
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
     /// \returns true if iteration is successful, false otherwise
@@ -51,6 +54,19 @@ public:
     bool call_with_validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+    /// \brief Starts a single iteration of a Function without blocking the caller.
+    ///    The execution is ordered after pending asynchronous writes of the inputs and pending
+    ///    asynchronous reads and writes of the outputs (see Tensor::begin_write and
+    ///    Tensor::begin_read), so input staging, compute and output readback of consecutive
+    ///    requests can overlap when each request uses its own set of tensors.
+    /// \param outputs vector of runtime::Tensor used as outputs
+    /// \param inputs vector of runtime::Tensor used as inputs
+    /// \returns A future holding the result of call(). The Executable and the tensors must
+    ///    outlive the execution.
+    virtual std::future<bool>
+        begin_execute(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                      const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
     /// \brief Collect performance information gathered on a Function.
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
@@ -59,10 +59,18 @@ shared_ptr<runtime::Executable>
     runtime::gcpu::GCPUBackend::compile(shared_ptr<Function> function,
                                         bool enable_performance_collection)
 {
-    return make_shared<GCPUExecutable>(function, enable_performance_collection);
+    auto exec = make_shared<GCPUExecutable>(function, enable_performance_collection);
+    exec->set_thread_pool(m_thread_pool_config.get_thread_pool());
+    return exec;
 }
 
 bool runtime::gcpu::GCPUBackend::is_supported(const Node& node) const
 {
     return m_unsupported_op_name_list.find(node.description()) == m_unsupported_op_name_list.end();
 }
+
+bool runtime::gcpu::GCPUBackend::set_config(const map<string, string>& config, string& error)
+{
+    error = "";
+    return m_thread_pool_config.set_config(config, error) && ThreadPoolConfig::has_config(config);
+}
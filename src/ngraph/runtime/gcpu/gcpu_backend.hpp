@@ -17,13 +17,17 @@
 #pragma once
 
 #include <initializer_list>
+#include <map>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/reference/allreduce.hpp"
 #include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 
 namespace ngraph
 {
@@ -56,6 +60,11 @@ public:
 
     bool is_supported(const Node& node) const override;
 
+    /// \brief Accepts intra_op_parallelism, the number of threads that kernels of executables
+    ///        compiled afterwards split their work across
+    bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
+
 private:
     std::set<std::string> m_unsupported_op_name_list;
+    ThreadPoolConfig m_thread_pool_config;
 };
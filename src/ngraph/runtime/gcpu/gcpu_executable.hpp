@@ -68,18 +68,13 @@ public:
     GCPUExecutable(const std::shared_ptr<Function>& function,
                    bool enable_performance_collection = false);
 
-    bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
-              const std::vector<std::shared_ptr<Tensor>>& intputs) override;
-
 private:
     int get_alignment() const { return 64; }
-    void generate_calls(const element::Type& type,
-                        const Node& op,
-                        const std::vector<std::shared_ptr<HostTensor>>& outputs,
-                        const std::vector<std::shared_ptr<HostTensor>>& inputs) override;
+    Kernel get_kernel(const element::Type& type, const Node& op) const override;
 
     template <typename T>
     void gop_engine(const Node& node,
+                    interpreter::OP_TYPEID type_id,
                     const std::vector<std::shared_ptr<HostTensor>>& out,
                     const std::vector<std::shared_ptr<HostTensor>>& args)
     {
@@ -87,7 +82,7 @@ private:
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wswitch-enum"
 #endif
-        switch (INTExecutable::get_typeid(node))
+        switch (type_id)
         {
         case ngraph::runtime::interpreter::OP_TYPEID::Broadcast:
         {
@@ -112,7 +107,7 @@ private:
                                node.get_output_shape(0));
             break;
         }
-        default: op_engine<T>(node, out, args); break;
+        default: op_engine<T>(node, type_id, out, args); break;
         }
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
 #pragma GCC diagnostic pop
@@ -61,7 +61,9 @@ shared_ptr<runtime::Executable>
     runtime::interpreter::INTBackend::compile(shared_ptr<Function> function,
                                               bool enable_performance_collection)
 {
-    return make_shared<INTExecutable>(function, enable_performance_collection);
+    auto exec = make_shared<INTExecutable>(function, enable_performance_collection);
+    exec->set_thread_pool(m_thread_pool_config.get_thread_pool());
+    return exec;
 }
 
 bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
@@ -92,7 +94,9 @@ std::shared_ptr<runtime::Executable> runtime::interpreter::INTBackend::load(istr
             {
                 vector<char> buffer = reader.read(info);
                 string model_string = string(buffer.data(), buffer.size());
-                exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                auto int_exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                int_exec->set_thread_pool(m_thread_pool_config.get_thread_pool());
+                exec = int_exec;
                 break;
             }
         }
@@ -110,5 +114,9 @@ bool runtime::interpreter::INTBackend::set_config(const map<string, string>& con
         error = it->second;
         rc = true;
     }
-    return rc;
+    if (!m_thread_pool_config.set_config(config, error))
+    {
+        return false;
+    }
+    return rc || ThreadPoolConfig::has_config(config);
 }
@@ -26,6 +26,7 @@
 
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 
 namespace ngraph
 {
@@ -60,8 +61,11 @@ public:
 
     bool is_supported(const Node& node) const override;
 
+    /// \brief Besides test_echo, accepts intra_op_parallelism, the number of threads that
+    ///        kernels of executables compiled afterwards split their work across
     bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
 
 private:
     std::set<std::string> m_unsupported_op_name_list;
+    ThreadPoolConfig m_thread_pool_config;
 };
@@ -23,10 +23,13 @@
 #include "ngraph/pass/assign_layout.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/fused_op_decomposition.hpp"
+#include "ngraph/pass/in_place_elementwise.hpp"
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/opset0_downgrade.hpp"
+#include "ngraph/pass/share_constants.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -76,9 +79,11 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
     pass_manager.register_pass<pass::Opset0Downgrade>();
     // Need to decompose any v0 fused ops, which were produced by the downgrade pass
     pass_manager.register_pass<pass::FusedOpDecomposition>();
+    pass_manager.register_pass<pass::ShareConstants>();
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
     pass_manager.register_pass<pass::Liveness>();
     pass_manager.run_passes(m_function);
+    plan_intermediate_memory();
     for (auto node : m_function->get_ordered_ops())
     {
         m_nodes.push_back(node);
@@ -91,6 +96,11 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
     , m_performance_counters_enabled{false}
 {
     m_function = deserialize(model_string);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ShareConstants>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.run_passes(m_function);
+    plan_intermediate_memory();
     for (auto node : m_function->get_ordered_ops())
     {
         m_nodes.push_back(node);
@@ -98,44 +108,103 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
     set_parameters_and_results(*m_function);
 }
 
+void runtime::interpreter::INTExecutable::plan_intermediate_memory()
+{
+    // The reference elementwise kernels compute every output element from the same element of
+    // the inputs so they may overwrite an input which dies at that op.
+    pass::Manager pass_manager;
+    bool offline_planning =
+        pass_manager.get_pass_config().get_pass_attribute("OfflineMemoryPlanning");
+    pass_manager.register_pass<pass::InPlaceElementwise>();
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment(), false, offline_planning);
+    pass_manager.run_passes(m_function);
+}
+
 bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
     runtime::event::Duration d1("call", "Interpreter");
+    lock_guard<mutex> lock(m_call_mutex);
+    ThreadPool::Scope thread_pool_scope(m_thread_pool.get());
 
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (auto tensor : inputs)
+    if (!m_execution_plan_valid)
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
+        build_execution_plan();
     }
+
+    // patch the caller's tensors into the plan
+    bind_tensors(m_input_bindings, inputs);
+    bind_tensors(m_output_bindings, outputs);
+
     if (m_nan_check_enabled)
     {
+        vector<shared_ptr<HostTensor>> func_inputs;
+        for (auto tensor : inputs)
+        {
+            func_inputs.push_back(static_pointer_cast<runtime::HostTensor>(tensor));
+        }
         perform_nan_check(func_inputs);
     }
 
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (auto tensor : outputs)
+    // for each step of the plan
+    for (const ExecutionStep& step : m_execution_plan)
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
+        runtime::event::Duration d2(step.node->description(), "Interpreter");
+        if (step.timer)
+        {
+            step.timer->start();
+        }
+        (this->*step.kernel)(*step.node, step.type_id, step.outputs, step.inputs);
+        if (step.timer)
+        {
+            step.timer->stop();
+        }
+        if (m_nan_check_enabled)
+        {
+            perform_nan_check(step.outputs, step.node.get());
+        }
     }
 
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
-    for (auto param : get_parameters())
+    // don't keep the caller's tensors alive beyond the call
+    bind_tensors(m_input_bindings, {});
+    bind_tensors(m_output_bindings, {});
+
+    return true;
+}
+
+void runtime::interpreter::INTExecutable::bind_tensors(
+    const vector<vector<TensorBinding>>& bindings,
+    const vector<shared_ptr<runtime::Tensor>>& tensors)
+{
+    for (size_t i = 0; i < bindings.size(); ++i)
     {
-        for (size_t i = 0; i < param->get_output_size(); ++i)
+        shared_ptr<HostTensor> host_tensor;
+        if (i < tensors.size())
+        {
+            host_tensor = static_pointer_cast<runtime::HostTensor>(tensors[i]);
+        }
+        for (const TensorBinding& binding : bindings[i])
         {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            ExecutionStep& step = m_execution_plan[binding.step];
+            (binding.is_output ? step.outputs : step.inputs)[binding.index] = host_tensor;
         }
     }
+}
 
-    // map function outputs -> HostTensor
+void runtime::interpreter::INTExecutable::build_execution_plan()
+{
+    m_execution_plan.clear();
+    m_input_bindings.assign(get_parameters().size(), vector<TensorBinding>());
+    m_output_bindings.assign(get_results().size(), vector<TensorBinding>());
+
+    // map function params and outputs -> index into the call() arguments
+    unordered_map<const descriptor::Tensor*, size_t> input_indices;
+    for (size_t input_count = 0; input_count < get_parameters().size(); ++input_count)
+    {
+        auto param = get_parameters()[input_count];
+        input_indices.insert({&param->output(0).get_tensor(), input_count});
+    }
+    unordered_map<const descriptor::Tensor*, size_t> output_indices;
     for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
     {
         auto output = get_results()[output_count];
@@ -143,110 +212,132 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         {
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
-        descriptor::Tensor* tensor = &output->output(0).get_tensor();
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        output_indices.insert({&output->output(0).get_tensor(), output_count});
     }
 
-    // for each ordered op in the graph
+    // intermediate tensors share the pool laid out by MemoryLayout, constants are used in place
+    m_intermediate_memory.reset(
+        new AlignedBuffer(m_function->get_temporary_pool_size(), get_alignment()));
+    unordered_map<const descriptor::Tensor*, shared_ptr<HostTensor>> intermediates;
     for (auto op : m_nodes)
     {
-        runtime::event::Duration d2(op->description(), "Interpreter");
         if (op->is_parameter())
         {
             continue;
         }
-
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
-        for (auto input : op->inputs())
+        if (auto constant = as_type_ptr<op::Constant>(op))
         {
-            descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            const descriptor::Tensor* tensor = &constant->output(0).get_tensor();
+            intermediates.insert(
+                {tensor,
+                 make_shared<runtime::HostTensor>(tensor->get_element_type(),
+                                                  tensor->get_shape(),
+                                                  const_cast<void*>(constant->get_data_ptr()),
+                                                  tensor->get_name())});
+            continue;
         }
 
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i)
+        ExecutionStep step;
+        step.node = op;
+        step.type_id = get_typeid(*op);
+        step.kernel = get_kernel(get_kernel_element_type(*op), *op);
+        step.timer = m_performance_counters_enabled ? &m_timer_map[op] : nullptr;
+
+        for (auto input : op->inputs())
         {
-            descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            const descriptor::Tensor* tensor = &input.get_tensor();
+            auto it = input_indices.find(tensor);
+            if (it != input_indices.end())
             {
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
-                tensor_map.insert({tensor, host_tensor});
+                m_input_bindings[it->second].push_back(
+                    {m_execution_plan.size(), step.inputs.size(), false});
+                step.inputs.push_back(nullptr);
             }
             else
             {
-                host_tensor = it->second;
+                step.inputs.push_back(intermediates.at(tensor));
             }
-            op_outputs.push_back(host_tensor);
         }
 
-        // get op type
-        element::Type type;
-        if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::Dequantize>(op) ||
-            is_type<op::ArgMin>(op) || is_type<op::ArgMax>(op))
-        {
-            type = op->get_input_element_type(0);
-        }
-        else if (is_type<op::Equal>(op) || is_type<op::Greater>(op) || is_type<op::GreaterEq>(op) ||
-                 is_type<op::Less>(op) || is_type<op::LessEq>(op) || is_type<op::NotEqual>(op))
-        {
-            // Get the type of the second input, not the first
-            // All BinaryElementwiseComparision ops have the same type for inputs
-            // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
-        }
-        else if (is_type<op::TopK>(op))
-        {
-            type = op->get_output_element_type(1);
-        }
-        else
+        for (size_t i = 0; i < op->get_output_size(); ++i)
         {
-            type = op->get_output_element_type(0);
+            const descriptor::Tensor* tensor = &op->output(i).get_tensor();
+            auto it = output_indices.find(tensor);
+            if (it != output_indices.end())
+            {
+                m_output_bindings[it->second].push_back(
+                    {m_execution_plan.size(), step.outputs.size(), true});
+                step.outputs.push_back(nullptr);
+            }
+            else
+            {
+                auto host_tensor = make_shared<runtime::HostTensor>(
+                    tensor->get_element_type(),
+                    tensor->get_shape(),
+                    m_intermediate_memory->get_ptr(tensor->get_pool_offset()),
+                    tensor->get_name());
+                intermediates.insert({tensor, host_tensor});
+                step.outputs.push_back(host_tensor);
+            }
         }
 
-        if (m_performance_counters_enabled)
-        {
-            m_timer_map[op].start();
-        }
-        generate_calls(type, *op.get(), op_outputs, op_inputs);
-        if (m_performance_counters_enabled)
-        {
-            m_timer_map[op].stop();
-        }
-        if (m_nan_check_enabled)
-        {
-            perform_nan_check(op_outputs, op.get());
-        }
+        m_execution_plan.push_back(step);
     }
+    m_execution_plan_valid = true;
+}
 
-    return true;
+element::Type runtime::interpreter::INTExecutable::get_kernel_element_type(const Node& op)
+{
+    element::Type type;
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+#endif
+    switch (get_typeid(op))
+    {
+    case OP_TYPEID::Convert:
+    case OP_TYPEID::Quantize:
+    case OP_TYPEID::Dequantize:
+    case OP_TYPEID::ArgMin:
+    case OP_TYPEID::ArgMax: type = op.get_input_element_type(0); break;
+    case OP_TYPEID::Equal:
+    case OP_TYPEID::Greater:
+    case OP_TYPEID::GreaterEq:
+    case OP_TYPEID::Less:
+    case OP_TYPEID::LessEq:
+    case OP_TYPEID::NotEqual:
+        // Get the type of the second input, not the first
+        // All BinaryElementwiseComparision ops have the same type for inputs
+        // Select has bool for first input and the type we are interested in for the second
+        type = op.get_input_element_type(1);
+        break;
+    case OP_TYPEID::TopK: type = op.get_output_element_type(1); break;
+    default: type = op.get_output_element_type(0); break;
+    }
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic pop
+#endif
+    return type;
 }
 
-void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
-                                                         const Node& op,
-                                                         const vector<shared_ptr<HostTensor>>& out,
-                                                         const vector<shared_ptr<HostTensor>>& in)
+runtime::interpreter::INTExecutable::Kernel
+    runtime::interpreter::INTExecutable::get_kernel(const element::Type& type, const Node& op) const
 {
+    Kernel kernel = nullptr;
     stringstream ss;
     switch (type)
     {
-    case element::Type_t::boolean: op_engine<char>(op, out, in); break;
-    case element::Type_t::f32: op_engine<float>(op, out, in); break;
-    case element::Type_t::f64: op_engine<double>(op, out, in); break;
-    case element::Type_t::i8: op_engine<int8_t>(op, out, in); break;
-    case element::Type_t::i16: op_engine<int16_t>(op, out, in); break;
-    case element::Type_t::i32: op_engine<int32_t>(op, out, in); break;
-    case element::Type_t::i64: op_engine<int64_t>(op, out, in); break;
-    case element::Type_t::u8: op_engine<uint8_t>(op, out, in); break;
-    case element::Type_t::u16: op_engine<uint16_t>(op, out, in); break;
-    case element::Type_t::u32: op_engine<uint32_t>(op, out, in); break;
-    case element::Type_t::u64: op_engine<uint64_t>(op, out, in); break;
+    case element::Type_t::boolean: kernel = &INTExecutable::op_engine<char>; break;
+    case element::Type_t::f32: kernel = &INTExecutable::op_engine<float>; break;
+    case element::Type_t::f64: kernel = &INTExecutable::op_engine<double>; break;
+    case element::Type_t::i8: kernel = &INTExecutable::op_engine<int8_t>; break;
+    case element::Type_t::i16: kernel = &INTExecutable::op_engine<int16_t>; break;
+    case element::Type_t::i32: kernel = &INTExecutable::op_engine<int32_t>; break;
+    case element::Type_t::i64: kernel = &INTExecutable::op_engine<int64_t>; break;
+    case element::Type_t::u8: kernel = &INTExecutable::op_engine<uint8_t>; break;
+    case element::Type_t::u16: kernel = &INTExecutable::op_engine<uint16_t>; break;
+    case element::Type_t::u32: kernel = &INTExecutable::op_engine<uint32_t>; break;
+    case element::Type_t::u64: kernel = &INTExecutable::op_engine<uint64_t>; break;
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
     case element::Type_t::u1:
@@ -255,6 +346,15 @@ void runtime::interpreter::INTExecutable::generate_calls(const element::Type& ty
         ss << "unsupported element type " << type << " op " << op.get_name();
         throw ngraph_error(ss.str());
     }
+    return kernel;
+}
+
+void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
+                                                         const Node& op,
+                                                         const vector<shared_ptr<HostTensor>>& out,
+                                                         const vector<shared_ptr<HostTensor>>& in)
+{
+    (this->*get_kernel(type, op))(op, get_typeid(op), out, in);
 }
 
 void runtime::interpreter::INTExecutable::set_nan_check(bool enable)
@@ -262,6 +362,12 @@ void runtime::interpreter::INTExecutable::set_nan_check(bool enable)
     m_nan_check_enabled = enable;
 }
 
+void runtime::interpreter::INTExecutable::set_thread_pool(const shared_ptr<ThreadPool>& thread_pool)
+{
+    lock_guard<mutex> lock(m_call_mutex);
+    m_thread_pool = thread_pool;
+}
+
 vector<runtime::PerformanceCounter>
     runtime::interpreter::INTExecutable::get_performance_data() const
 {
@@ -19,6 +19,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -116,6 +117,7 @@
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/runtime/reference/xor.hpp"
 #include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
 
@@ -159,6 +161,10 @@ public:
 
     void set_nan_check(bool enable);
 
+    /// \brief Kernels split their work across thread_pool. Without a pool they run on the
+    ///        calling thread.
+    void set_thread_pool(const std::shared_ptr<ThreadPool>& thread_pool);
+
     std::vector<PerformanceCounter> get_performance_data() const override;
 
     std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
@@ -182,22 +188,80 @@ protected:
     bool m_performance_counters_enabled = false;
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
+    // Serializes calls, which may overlap when started with begin_execute, since the
+    // performance counters and op states are updated in place
+    std::mutex m_call_mutex;
     std::vector<std::shared_ptr<Node>> m_nodes;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
     std::set<std::string> m_unsupported_op_name_list;
 
+    /// \brief A kernel specialized for one element type, see get_kernel
+    using Kernel = void (INTExecutable::*)(const Node& node,
+                                           OP_TYPEID type_id,
+                                           const std::vector<std::shared_ptr<HostTensor>>& out,
+                                           const std::vector<std::shared_ptr<HostTensor>>& args);
+
+    /// \brief One kernel invocation of the execution plan. Everything that does not depend
+    ///    on the tensors passed to call() is resolved when the plan is built.
+    struct ExecutionStep
+    {
+        std::shared_ptr<Node> node;
+        OP_TYPEID type_id;
+        Kernel kernel;
+        std::vector<std::shared_ptr<HostTensor>> inputs;
+        std::vector<std::shared_ptr<HostTensor>> outputs;
+        stopwatch* timer;
+    };
+
+    /// \brief A slot of the execution plan which is bound to a tensor passed to call()
+    struct TensorBinding
+    {
+        size_t step;
+        size_t index;
+        bool is_output;
+    };
+
+    bool m_execution_plan_valid = false;
+    std::vector<ExecutionStep> m_execution_plan;
+    std::vector<std::vector<TensorBinding>> m_input_bindings;
+    std::vector<std::vector<TensorBinding>> m_output_bindings;
+    std::unique_ptr<AlignedBuffer> m_intermediate_memory;
+    std::shared_ptr<ThreadPool> m_thread_pool;
+
     static OP_TYPEID get_typeid(const Node& node);
 
+    /// \brief Get the element type an op's kernel is specialized for.
+    static element::Type get_kernel_element_type(const Node& node);
+
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
-    virtual void generate_calls(const element::Type& type,
-                                const Node& op,
-                                const std::vector<std::shared_ptr<HostTensor>>& outputs,
-                                const std::vector<std::shared_ptr<HostTensor>>& inputs);
+    /// \brief Lay out the intermediate tensors of m_function in one pool, reusing the memory of
+    ///    dead tensors. Requires liveness information.
+    void plan_intermediate_memory();
+
+    /// \brief Build the execution plan for m_nodes. Intermediate tensors live in
+    ///    m_intermediate_memory, tensors passed to call() are patched in through the bindings.
+    void build_execution_plan();
+
+    /// \brief Point the plan slots of each binding at the matching tensor, or at nothing if
+    ///    there are fewer tensors than bindings.
+    void bind_tensors(const std::vector<std::vector<TensorBinding>>& bindings,
+                      const std::vector<std::shared_ptr<runtime::Tensor>>& tensors);
+
+    /// \brief Get the kernel specialized for an element type
+    /// \param type The element type returned by get_kernel_element_type
+    /// \param op The op which is going to be executed, for error reporting
+    virtual Kernel get_kernel(const element::Type& type, const Node& op) const;
+
+    void generate_calls(const element::Type& type,
+                        const Node& op,
+                        const std::vector<std::shared_ptr<HostTensor>>& outputs,
+                        const std::vector<std::shared_ptr<HostTensor>>& inputs);
 
     template <typename T>
     void op_engine(const Node& node,
+                   OP_TYPEID type_id,
                    const std::vector<std::shared_ptr<HostTensor>>& out,
                    const std::vector<std::shared_ptr<HostTensor>>& args)
     {
@@ -209,7 +273,7 @@ protected:
 #pragma GCC diagnostic error "-Wswitch"
 #pragma GCC diagnostic error "-Wswitch-enum"
 #endif
-        switch (get_typeid(node))
+        switch (type_id)
         {
         case OP_TYPEID::Abs:
         {
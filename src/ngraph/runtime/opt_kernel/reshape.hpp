@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <cstring>
+
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -222,6 +225,46 @@ namespace ngraph
                     }
                 }
             }
+            /// \brief Reshape of any rank which writes the output one row of the innermost
+            ///        permuted axis at a time. The rows are written in parallel.
+            template <typename T>
+            void reshape_rows(const T* in,
+                              T* out,
+                              const Shape& in_shape,
+                              const AxisVector& in_axis_order)
+            {
+                size_t rank = in_shape.size();
+                std::vector<size_t> in_strides = row_major_strides(in_shape);
+                Shape size(rank);
+                std::vector<size_t> stride(rank);
+                for (size_t i = 0; i < rank; i++)
+                {
+                    size[i] = in_shape[in_axis_order[i]];
+                    stride[i] = in_strides[in_axis_order[i]];
+                }
+                size_t row_size = size[rank - 1];
+                size_t row_stride = stride[rank - 1];
+                size_t rows = shape_size(size) / row_size;
+                parallel_for(rows, row_size, [&](size_t begin, size_t end) {
+                    for (size_t row = begin; row < end; ++row)
+                    {
+                        size_t in_index = 0;
+                        size_t rest = row;
+                        for (size_t i = rank - 1; i-- > 0;)
+                        {
+                            in_index += (rest % size[i]) * stride[i];
+                            rest /= size[i];
+                        }
+                        const T* in_row = in + in_index;
+                        T* out_row = out + row * row_size;
+                        for (size_t j = 0; j < row_size; ++j)
+                        {
+                            out_row[j] = in_row[j * row_stride];
+                        }
+                    }
+                });
+            }
+
             template <typename T>
             void reshape(const T* in,
                          T* out,
@@ -229,6 +272,31 @@ namespace ngraph
                          const AxisVector& in_axis_order,
                          const Shape& out_shape)
             {
+                size_t count = shape_size(in_shape);
+                if (count == 0)
+                {
+                    return;
+                }
+                bool is_identity = true;
+                for (size_t i = 0; i < in_axis_order.size(); i++)
+                {
+                    is_identity = is_identity && in_axis_order[i] == i;
+                }
+                if (is_identity)
+                {
+                    // Only the shape changes, the elements keep their order
+                    parallel_for(count * sizeof(T), 1, [&](size_t begin, size_t end) {
+                        std::memcpy(reinterpret_cast<char*>(out) + begin,
+                                    reinterpret_cast<const char*>(in) + begin,
+                                    end - begin);
+                    });
+                    return;
+                }
+                if (count >= 1 << 16)
+                {
+                    reshape_rows<T>(in, out, in_shape, in_axis_order);
+                    return;
+                }
                 switch (in_shape.size())
                 {
                 case 0: reshape_in0<T>(in, out, in_shape, in_axis_order, out_shape); break;
@@ -18,6 +18,8 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/thread_pool.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -27,11 +29,13 @@ namespace ngraph
             template <typename T>
             void abs(const T* arg, T* out, size_t count)
             {
-                for (size_t i = 0; i < count; i++)
-                {
-                    // TODO: generic "abs" doesn't work here for some reason.
-                    out[i] = (arg[i] < T(0) ? T(-arg[i]) : arg[i]);
-                }
+                parallel_for(count, 1, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        // TODO: generic "abs" doesn't work here for some reason.
+                        out[i] = (arg[i] < T(0) ? T(-arg[i]) : arg[i]);
+                    }
+                });
             }
         }
     }
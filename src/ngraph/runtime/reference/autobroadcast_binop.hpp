@@ -20,6 +20,7 @@
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -57,10 +58,12 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    parallel_for(shape_size(arg0_shape), 1, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            out[i] = elementwise_functor(arg0[i], arg1[i]);
+                        }
+                    });
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -256,10 +259,12 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i], arg2[i]);
-                    }
+                    parallel_for(shape_size(arg0_shape), 1, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            out[i] = elementwise_functor(arg0[i], arg1[i], arg2[i]);
+                        }
+                    });
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // Uses same approach as autobroadcast_binop.
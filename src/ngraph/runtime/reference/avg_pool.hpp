@@ -16,7 +16,6 @@
 
 #pragma once
 
-#include <cfenv>
 #include <cmath>
 #include <numeric>
 #include <stdexcept>
@@ -24,6 +23,8 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
+#include "ngraph/runtime/reference/round.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -132,13 +133,11 @@ namespace ngraph
                           const Shape& padding_above,
                           bool include_padding_in_avg_computation)
             {
-                auto old_mode = std::fegetround();
-                std::fesetround(FE_TONEAREST);
                 // At the outermost level we will walk over every output coordinate O.
                 CoordinateTransform output_transform(out_shape);
+                size_t window_size = shape_size(window_shape);
 
-                for (const Coordinate& out_coord : output_transform)
-                {
+                parallel_planes(out_shape, window_size, [&](const Coordinate& out_coord) {
                     // Our output coordinate O will have the form:
                     //
                     //   (N,chan,i_1,...,i_n)
@@ -237,15 +236,14 @@ namespace ngraph
 
                     if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value)
                     {
-                        out[output_transform.index(out_coord)] =
-                            static_cast<T>(std::nearbyint(static_cast<float>(result) / n_elements));
+                        out[output_transform.index(out_coord)] = static_cast<T>(
+                            round_to_nearest_even(static_cast<float>(result) / n_elements));
                     }
                     else
                     {
                         out[output_transform.index(out_coord)] = result / n_elements;
                     }
-                    std::fesetround(old_mode);
-                }
+                });
             }
         }
     }
@@ -37,23 +37,14 @@ namespace ngraph
                                const Shape& arg1_shape,
                                const Shape& out_shape)
             {
-                // Call dot for each pair of tensors in the batch
-                const size_t batch_size = arg0_shape[0];
-                const Shape dot_input0_shape{arg0_shape[1], arg0_shape[2]};
-                const Shape dot_input1_shape{arg1_shape[1], arg1_shape[2]};
-                const Shape dot_output_shape{out_shape[1], out_shape[2]};
-                const size_t input0_offset = shape_size(dot_input0_shape);
-                const size_t input1_offset = shape_size(dot_input1_shape);
-                const size_t output_offset = shape_size(dot_output_shape);
+                // Multiply each pair of matrices in the batch
+                const size_t batch_size = out_shape[0];
+                const size_t m = arg0_shape[1];
+                const size_t k = arg0_shape[2];
+                const size_t n = arg1_shape[2];
                 for (size_t i = 0; i < batch_size; ++i)
                 {
-                    dot(arg0 + i * input0_offset,
-                        arg1 + i * input1_offset,
-                        out + i * output_offset,
-                        dot_input0_shape,
-                        dot_input1_shape,
-                        dot_output_shape,
-                        1);
+                    matmul(arg0 + i * m * k, arg1 + i * k * n, out + i * m * n, m, k, n);
                 }
             }
         }
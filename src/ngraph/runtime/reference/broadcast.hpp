@@ -18,8 +18,9 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/check.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_range.hpp"
 
 namespace ngraph
 {
@@ -43,25 +44,32 @@ namespace ngraph
                         adjusted_in_shape.push_back(length);
                     }
                 }
-                // Remove 1s from out_shape
-                AxisSet adjusted_axes(broadcast_axes);
-                for (uint64_t axis = 0; axis < out_shape.size(); ++axis)
+                // Walk the output. Broadcast axes and axes of length 1 do not move in the input.
+                std::vector<std::ptrdiff_t> in_strides = StridedRange::strides(adjusted_in_shape);
+                std::vector<std::ptrdiff_t> arg_strides;
+                size_t in_axis = 0;
+                for (size_t axis = 0; axis < out_shape.size(); axis++)
                 {
-                    auto length = out_shape.at(axis);
-                    if (length == 1)
+                    if (broadcast_axes.count(axis) != 0 || out_shape[axis] == 1)
                     {
-                        adjusted_axes.insert(axis);
+                        arg_strides.push_back(0);
+                    }
+                    else
+                    {
+                        NGRAPH_CHECK(in_axis < in_strides.size());
+                        arg_strides.push_back(in_strides[in_axis++]);
                     }
                 }
-                CoordinateTransform input_transform(adjusted_in_shape);
-                CoordinateTransform output_transform(out_shape);
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    Coordinate input_coord = reduce(output_coord, adjusted_axes);
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-                }
+                StridedRange range(out_shape, StridedRange::strides(out_shape), arg_strides);
+                size_t run_length = range.get_run_length();
+                std::ptrdiff_t arg_step = range.get_run_stride_b();
+                range.for_each([&](size_t out_index, size_t arg_index) {
+                    for (size_t i = 0; i < run_length; i++)
+                    {
+                        out[out_index + i] = arg[arg_index + i * arg_step];
+                    }
+                });
             }
         }
     }
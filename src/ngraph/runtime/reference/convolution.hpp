@@ -16,13 +16,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
 #include <functional>
+#include <vector>
 
 #include "ngraph/axis_vector.hpp"
+#include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
+#include "ngraph/runtime/reference/widen.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -31,23 +37,269 @@ namespace ngraph
     {
         namespace reference
         {
-            template <typename T>
-            struct widen
+            namespace convolution_detail
             {
-                using type = T;
-            };
+                // Upper bound on the number of elements of an im2col buffer
+                constexpr size_t max_col_elements = size_t(1) << 22;
 
-            template <>
-            struct widen<float>
-            {
-                using type = double;
-            };
+                // Parameter of spatial axis i (0 is height, 1 is width) of a 1-D or 2-D
+                // convolution. 1-D convolutions are treated as 2-D with a unit height.
+                template <typename VECTOR>
+                size_t spatial(const VECTOR& values, size_t i, size_t unit)
+                {
+                    return values.size() == 1 ? (i == 0 ? unit : values[0]) : values[i];
+                }
+
+                // True if the padded or dilated input has taps that are not read from the input
+                // and the filter has an infinite or NaN value. The im2col product multiplies
+                // those taps by the filter, giving NaN where skipping them gives a finite value.
+                template <typename FILTER>
+                bool has_nonfinite_padded_taps(const FILTER* filter,
+                                               const Shape& filter_shape,
+                                               const CoordinateDiff& in_pad_below,
+                                               const CoordinateDiff& in_pad_above,
+                                               const Strides& in_dilation)
+                {
+                    bool padded = false;
+                    for (size_t i = 0; i < in_dilation.size(); i++)
+                    {
+                        padded = padded || in_pad_below[i] > 0 || in_pad_above[i] > 0 ||
+                                 in_dilation[i] > 1;
+                    }
+                    if (!padded)
+                    {
+                        return false;
+                    }
+                    size_t filter_size = shape_size(filter_shape);
+                    for (size_t i = 0; i < filter_size; i++)
+                    {
+                        if (!std::isfinite(static_cast<double>(filter[i])))
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+            }
 
-            template <>
-            struct widen<double>
+            /// \brief 1-D and 2-D convolution as a matrix product. Each batch is unrolled into
+            ///        a [in channels * filter height * filter width, output pixels] buffer
+            ///        (im2col), processed in bounded chunks of output rows, and multiplied by the
+            ///        filter viewed as [out channels, in channels * filter height * filter
+            ///        width]. 1x1 filters with unit strides and no padding multiply the input
+            ///        directly. Padded taps are multiplied by the filter rather than skipped, so
+            ///        general_convolution only uses this for finite filters or unpadded inputs.
+            ///        Arguments are those of general_convolution.
+            template <typename INPUT,
+                      typename FILTER,
+                      typename OUTPUT,
+                      typename ACCUMULATION = typename widen<OUTPUT>::type>
+            void im2col_convolution(const INPUT* in,
+                                    const FILTER* filter,
+                                    OUTPUT* out,
+                                    const Shape& in_shape,
+                                    const Shape& filter_shape,
+                                    const Shape& out_shape,
+                                    const Strides& stride,
+                                    const Strides& filter_dilation,
+                                    const CoordinateDiff& in_pad_below,
+                                    const Strides& in_dilation,
+                                    size_t in_batch_axis,
+                                    size_t in_channel_axis,
+                                    size_t filter_out_channel_axis,
+                                    size_t filter_in_channel_axis,
+                                    size_t out_batch_axis,
+                                    size_t out_channel_axis,
+                                    const float* input_scale = nullptr,
+                                    const INPUT* input_zero_point = nullptr,
+                                    const float* filter_scale = nullptr,
+                                    const FILTER* filter_zero_point = nullptr,
+                                    const float* output_scale = nullptr,
+                                    const OUTPUT* output_zero_point = nullptr)
             {
-                using type = long double;
-            };
+                using convolution_detail::spatial;
+
+                NGRAPH_CHECK(in_shape.size() == 3 || in_shape.size() == 4,
+                             "im2col convolution supports 1-D and 2-D convolutions");
+
+                Shape in_spatial(in_shape.begin() + 2, in_shape.end());
+                Shape filter_spatial(filter_shape.begin() + 2, filter_shape.end());
+                Shape out_spatial(out_shape.begin() + 2, out_shape.end());
+                size_t in_h = spatial(in_spatial, 0, 1);
+                size_t in_w = spatial(in_spatial, 1, 1);
+                size_t filter_h = spatial(filter_spatial, 0, 1);
+                size_t filter_w = spatial(filter_spatial, 1, 1);
+                size_t out_h = spatial(out_spatial, 0, 1);
+                size_t out_w = spatial(out_spatial, 1, 1);
+                size_t stride_h = spatial(stride, 0, 1);
+                size_t stride_w = spatial(stride, 1, 1);
+                size_t dilation_h = spatial(filter_dilation, 0, 1);
+                size_t dilation_w = spatial(filter_dilation, 1, 1);
+                size_t in_dilation_h = spatial(in_dilation, 0, 1);
+                size_t in_dilation_w = spatial(in_dilation, 1, 1);
+                std::ptrdiff_t pad_h = in_spatial.size() == 1 ? 0 : in_pad_below[0];
+                std::ptrdiff_t pad_w = in_pad_below[in_spatial.size() - 1];
+
+                size_t batches = in_shape[in_batch_axis];
+                size_t in_channels = in_shape[in_channel_axis];
+                size_t out_channels = filter_shape[filter_out_channel_axis];
+                size_t filter_pixels = filter_h * filter_w;
+                size_t out_pixels = out_h * out_w;
+                size_t depth = in_channels * filter_pixels;
+                NGRAPH_CHECK(filter_shape[filter_in_channel_axis] == in_channels);
+
+                std::vector<size_t> in_strides = row_major_strides(in_shape);
+                std::vector<size_t> out_strides = row_major_strides(out_shape);
+                size_t in_batch_stride = in_strides[in_batch_axis];
+                size_t in_channel_stride = in_strides[in_channel_axis];
+                size_t out_batch_stride = out_strides[out_batch_axis];
+                size_t out_channel_stride = out_strides[out_channel_axis];
+
+                // The filter as an [out_channels, depth] matrix
+                const FILTER* filter_matrix = filter;
+                std::vector<FILTER> gathered_filter;
+                if (filter_out_channel_axis != 0)
+                {
+                    gathered_filter.resize(out_channels * depth);
+                    for (size_t oc = 0; oc < out_channels; oc++)
+                    {
+                        for (size_t ic = 0; ic < in_channels; ic++)
+                        {
+                            std::copy(filter + (ic * out_channels + oc) * filter_pixels,
+                                      filter + (ic * out_channels + oc + 1) * filter_pixels,
+                                      &gathered_filter[(oc * in_channels + ic) * filter_pixels]);
+                        }
+                    }
+                    filter_matrix = gathered_filter.data();
+                }
+
+                bool is_quantized = input_scale && input_zero_point && filter_scale &&
+                                    filter_zero_point && output_scale && output_zero_point;
+                INPUT pad_value = is_quantized ? *input_zero_point : INPUT(0);
+                bool standard_out = out_batch_axis == 0 && out_channel_axis == 1;
+
+                auto multiply = [&](const INPUT* col, OUTPUT* result, size_t pixels) {
+                    matmul<FILTER, INPUT, OUTPUT, ACCUMULATION>(filter_matrix,
+                                                                col,
+                                                                result,
+                                                                out_channels,
+                                                                depth,
+                                                                pixels,
+                                                                filter_scale,
+                                                                filter_zero_point,
+                                                                input_scale,
+                                                                input_zero_point,
+                                                                output_scale,
+                                                                output_zero_point);
+                };
+
+                // Unrolls the receptive field of output rows [row_start, row_start + rows) of one
+                // input channel into filter_pixels consecutive rows of an im2col matrix
+                auto unroll_channel =
+                    [&](const INPUT* in_channel, INPUT* col_row, size_t row_start, size_t rows) {
+                    for (size_t kh = 0; kh < filter_h; kh++)
+                    {
+                        for (size_t kw = 0; kw < filter_w; kw++)
+                        {
+                            for (size_t oh = row_start; oh < row_start + rows; oh++)
+                            {
+                                // Position in the padded, dilated input
+                                std::ptrdiff_t h = static_cast<std::ptrdiff_t>(
+                                                       oh * stride_h + kh * dilation_h) -
+                                                   pad_h;
+                                bool row_valid = h >= 0 && h % in_dilation_h == 0 &&
+                                                 static_cast<size_t>(h) / in_dilation_h <
+                                                     in_h;
+                                if (!row_valid)
+                                {
+                                    std::fill(col_row, col_row + out_w, pad_value);
+                                    col_row += out_w;
+                                    continue;
+                                }
+                                const INPUT* in_row =
+                                    in_channel + (static_cast<size_t>(h) / in_dilation_h) *
+                                                     in_w;
+                                for (size_t ow = 0; ow < out_w; ow++)
+                                {
+                                    std::ptrdiff_t w =
+                                        static_cast<std::ptrdiff_t>(ow * stride_w +
+                                                                    kw * dilation_w) -
+                                        pad_w;
+                                    bool valid = w >= 0 && w % in_dilation_w == 0 &&
+                                                 static_cast<size_t>(w) / in_dilation_w <
+                                                     in_w;
+                                    *col_row++ =
+                                        valid ? in_row[static_cast<size_t>(w) /
+                                                       in_dilation_w]
+                                              : pad_value;
+                                }
+                            }
+                        }
+                    }
+                };
+
+                // Direct path: each batch already is an [in_channels, pixels] matrix
+                if (filter_pixels == 1 && stride_h == 1 && stride_w == 1 && pad_h == 0 &&
+                    pad_w == 0 && in_dilation_h == 1 && in_dilation_w == 1 && out_h == in_h &&
+                    out_w == in_w && in_channel_stride == in_h * in_w && standard_out)
+                {
+                    for (size_t b = 0; b < batches; b++)
+                    {
+                        multiply(in + b * in_batch_stride, out + b * out_batch_stride, out_pixels);
+                    }
+                    return;
+                }
+
+                if (out_pixels == 0)
+                {
+                    return;
+                }
+                size_t chunk_rows = std::max<size_t>(
+                    1, convolution_detail::max_col_elements / std::max<size_t>(1, depth * out_w));
+                chunk_rows = std::min(chunk_rows, out_h);
+                std::vector<INPUT> col(depth * chunk_rows * out_w);
+                std::vector<OUTPUT> result;
+                if (!standard_out || chunk_rows != out_h)
+                {
+                    result.resize(out_channels * chunk_rows * out_w);
+                }
+
+                for (size_t b = 0; b < batches; b++)
+                {
+                    for (size_t row_start = 0; row_start < out_h; row_start += chunk_rows)
+                    {
+                        size_t rows = std::min(chunk_rows, out_h - row_start);
+                        size_t pixels = rows * out_w;
+
+                        // Each input channel fills its own rows of col
+                        parallel_for(
+                            in_channels, filter_pixels * pixels, [&](size_t begin, size_t end) {
+                                for (size_t ic = begin; ic < end; ic++)
+                                {
+                                    unroll_channel(in + b * in_batch_stride +
+                                                       ic * in_channel_stride,
+                                                   col.data() + ic * filter_pixels * pixels,
+                                                   row_start,
+                                                   rows);
+                                }
+                            });
+
+                        if (result.empty())
+                        {
+                            multiply(col.data(), out + b * out_batch_stride, pixels);
+                            continue;
+                        }
+                        multiply(col.data(), result.data(), pixels);
+                        for (size_t oc = 0; oc < out_channels; oc++)
+                        {
+                            std::copy(result.begin() + oc * pixels,
+                                      result.begin() + (oc + 1) * pixels,
+                                      out + b * out_batch_stride + oc * out_channel_stride +
+                                          row_start * out_w);
+                        }
+                    }
+                }
+            }
 
             // in: NC_I...
             // filter: C_OC_I...
@@ -80,6 +332,37 @@ namespace ngraph
                                      const float* output_scale = nullptr,
                                      const OUTPUT* output_zero_point = nullptr)
             {
+                // Non-finite filters keep the coordinate walk, which skips padded taps
+                if ((in_shape.size() == 3 || in_shape.size() == 4) &&
+                    !convolution_detail::has_nonfinite_padded_taps(
+                        filter, filter_shape, in_pad_below, in_pad_above, in_dilation))
+                {
+                    im2col_convolution<INPUT, FILTER, OUTPUT, ACCUMULATION>(
+                        in,
+                        filter,
+                        out,
+                        in_shape,
+                        filter_shape,
+                        out_shape,
+                        stride,
+                        filter_dilation,
+                        in_pad_below,
+                        in_dilation,
+                        in_batch_axis,
+                        in_channel_axis,
+                        filter_out_channel_axis,
+                        filter_in_channel_axis,
+                        out_batch_axis,
+                        out_channel_axis,
+                        input_scale,
+                        input_zero_point,
+                        filter_scale,
+                        filter_zero_point,
+                        output_scale,
+                        output_zero_point);
+                    return;
+                }
+
                 bool is_quantized = false;
                 if (input_scale && input_zero_point && filter_scale && filter_zero_point &&
                     output_scale && output_zero_point)
@@ -19,7 +19,8 @@
 #include <cmath>
 
 #include "ngraph/axis_set.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -37,19 +38,22 @@ namespace ngraph
                             const Shape& scale_zero_point_shape,
                             const AxisSet& axes)
             {
-                CoordinateTransform input_transform(input_shape);
-                CoordinateTransform scale_zero_point_transform(scale_zero_point_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate scale_zero_point_coord = project(input_coord, axes);
-
-                    output[input_transform.index(input_coord)] =
-                        static_cast<REAL>((
-                            input[input_transform.index(input_coord)] -
-                            zero_point[scale_zero_point_transform.index(scale_zero_point_coord)])) *
-                        scale[scale_zero_point_transform.index(scale_zero_point_coord)];
-                }
+                // The scale and zero point have the shape of the input projected onto axes
+                NGRAPH_CHECK(scale_zero_point_shape == project(input_shape, axes),
+                             "scale and zero point shape ",
+                             scale_zero_point_shape,
+                             " is not the input shape ",
+                             input_shape,
+                             " projected onto axes ",
+                             axes);
+                parallel_projected_rows(
+                    input_shape, axes, 2, [&](size_t index, size_t j, size_t j_stride, size_t n) {
+                        for (size_t i = 0; i < n; ++i, j += j_stride)
+                        {
+                            output[index + i] =
+                                static_cast<REAL>((input[index + i] - zero_point[j])) * scale[j];
+                        }
+                    });
             }
         }
     }
@@ -16,13 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cfenv>
 #include <cmath>
 #include <utility>
+#include <vector>
 
-#include <cfenv>
-#include <functional>
-#include "convolution.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/reference/widen.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -31,6 +33,194 @@ namespace ngraph
     {
         namespace reference
         {
+            namespace dot_detail
+            {
+                // Rows of the output computed together, sharing each load of an arg1 row
+                constexpr size_t block_rows = 4;
+                // Columns of arg1 kept hot in cache while walking all rows of arg0
+                constexpr size_t block_cols = 256;
+                // Depth of the reduction per pass over an arg1 column block
+                constexpr size_t block_depth = 128;
+                // Rows of the output computed by one parallel task
+                constexpr size_t panel_rows = 32;
+
+                // acc[r][j] += (a[r][kk] - a_zero) * (b[kk][j] - b_zero) for `rows` rows.
+                // The inner loop is unit stride over arg1 and the accumulators so the compiler
+                // can vectorize it.
+                template <size_t ROWS,
+                          typename INPUT0,
+                          typename INPUT1,
+                          typename ACCUMULATION>
+                void accumulate_rows(const INPUT0* arg0,
+                                     const INPUT1* arg1,
+                                     ACCUMULATION* acc,
+                                     size_t k,
+                                     size_t n,
+                                     size_t depth,
+                                     size_t cols,
+                                     ACCUMULATION arg0_zero,
+                                     ACCUMULATION arg1_zero)
+                {
+                    for (size_t kk = 0; kk < depth; kk++)
+                    {
+                        ACCUMULATION a[ROWS];
+                        for (size_t r = 0; r < ROWS; r++)
+                        {
+                            a[r] = static_cast<ACCUMULATION>(arg0[r * k + kk]) - arg0_zero;
+                        }
+                        const INPUT1* b = arg1 + kk * n;
+                        for (size_t j = 0; j < cols; j++)
+                        {
+                            ACCUMULATION b_j = static_cast<ACCUMULATION>(b[j]) - arg1_zero;
+                            for (size_t r = 0; r < ROWS; r++)
+                            {
+                                acc[r * block_cols + j] += a[r] * b_j;
+                            }
+                        }
+                    }
+                }
+
+                // Restores the caller's rounding mode, only touching it when it differs
+                class RoundToNearest
+                {
+                public:
+                    RoundToNearest()
+                        : m_old_mode(std::fegetround())
+                    {
+                        if (m_old_mode != FE_TONEAREST)
+                        {
+                            std::fesetround(FE_TONEAREST);
+                        }
+                    }
+                    ~RoundToNearest()
+                    {
+                        if (m_old_mode != FE_TONEAREST)
+                        {
+                            std::fesetround(m_old_mode);
+                        }
+                    }
+
+                private:
+                    int m_old_mode;
+                };
+            }
+
+            /// \brief Row major matrix product out[m, n] = sum over k of arg0[m, k] * arg1[k, n],
+            ///        blocked over the columns and depth of arg1 and tiled over rows of arg0.
+            ///        Panels of rows and column blocks run in parallel on the current ThreadPool.
+            ///
+            /// When all of the quantization parameters are given the inputs are offset by their
+            /// zero points and the result is requantized with
+            /// round(sum * input0_scale * input1_scale / output_scale) + output_zero_point.
+            template <typename INPUT0,
+                      typename INPUT1,
+                      typename OUTPUT,
+                      typename ACCUMULATION = typename widen<OUTPUT>::type>
+            void matmul(const INPUT0* arg0,
+                        const INPUT1* arg1,
+                        OUTPUT* out,
+                        size_t m,
+                        size_t k,
+                        size_t n,
+                        const float* input0_scale = nullptr,
+                        const INPUT0* input0_zero_point = nullptr,
+                        const float* input1_scale = nullptr,
+                        const INPUT1* input1_zero_point = nullptr,
+                        const float* output_scale = nullptr,
+                        const OUTPUT* output_zero_point = nullptr)
+            {
+                using namespace dot_detail;
+
+                bool is_quantized = input0_scale && input0_zero_point && input1_scale &&
+                                    input1_zero_point && output_scale && output_zero_point;
+                ACCUMULATION arg0_zero =
+                    is_quantized ? static_cast<ACCUMULATION>(*input0_zero_point) : 0;
+                ACCUMULATION arg1_zero =
+                    is_quantized ? static_cast<ACCUMULATION>(*input1_zero_point) : 0;
+                float scale = is_quantized ? *input0_scale * *input1_scale / *output_scale : 1;
+
+                // Tasks are (panel of rows, column block) pairs. Consecutive tasks share a column
+                // block so it stays in cache while a thread walks down the rows of arg0.
+                size_t row_panels = (m + panel_rows - 1) / panel_rows;
+                size_t col_blocks = (n + block_cols - 1) / block_cols;
+                parallel_for(
+                    row_panels * col_blocks,
+                    panel_rows * block_cols * k,
+                    [&](size_t begin, size_t end) {
+                        // The rounding mode is per thread
+                        RoundToNearest round_to_nearest;
+                        std::vector<ACCUMULATION> acc(panel_rows * block_cols);
+                        for (size_t task = begin; task < end; task++)
+                        {
+                            size_t row_start = (task % row_panels) * panel_rows;
+                            size_t rows = std::min(panel_rows, m - row_start);
+                            size_t col = (task / row_panels) * block_cols;
+                            size_t cols = std::min(block_cols, n - col);
+                            std::fill(acc.begin(), acc.end(), ACCUMULATION(0));
+                            for (size_t depth_start = 0; depth_start < k;
+                                 depth_start += block_depth)
+                            {
+                                size_t depth = std::min(block_depth, k - depth_start);
+                                const INPUT0* a = arg0 + row_start * k + depth_start;
+                                const INPUT1* b = arg1 + depth_start * n + col;
+                                size_t row = 0;
+                                for (; row + block_rows <= rows; row += block_rows)
+                                {
+                                    accumulate_rows<block_rows>(a + row * k,
+                                                                b,
+                                                                &acc[row * block_cols],
+                                                                k,
+                                                                n,
+                                                                depth,
+                                                                cols,
+                                                                arg0_zero,
+                                                                arg1_zero);
+                                }
+                                for (; row < rows; row++)
+                                {
+                                    accumulate_rows<1>(a + row * k,
+                                                       b,
+                                                       &acc[row * block_cols],
+                                                       k,
+                                                       n,
+                                                       depth,
+                                                       cols,
+                                                       arg0_zero,
+                                                       arg1_zero);
+                                }
+                            }
+
+                            for (size_t row = 0; row < rows; row++)
+                            {
+                                const ACCUMULATION* sum = &acc[row * block_cols];
+                                OUTPUT* out_row = out + (row_start + row) * n + col;
+                                if (is_quantized)
+                                {
+                                    for (size_t j = 0; j < cols; j++)
+                                    {
+                                        out_row[j] =
+                                            static_cast<OUTPUT>(std::round(
+                                                static_cast<float>(sum[j]) * scale)) +
+                                            *output_zero_point;
+                                    }
+                                }
+                                else
+                                {
+                                    for (size_t j = 0; j < cols; j++)
+                                    {
+                                        out_row[j] = static_cast<OUTPUT>(sum[j]);
+                                    }
+                                }
+                            }
+                        }
+                    });
+            }
+
+            /// \brief Generalized dot product. The trailing reduction_axes_count axes of arg0 are
+            ///        contracted with the leading reduction_axes_count axes of arg1.
+            ///
+            /// In row major layout the contracted axes are contiguous in both arguments, so this
+            /// is always a matrix product of arg0 viewed as [m, k] and arg1 viewed as [k, n].
             template <typename INPUT0,
                       typename INPUT1,
                       typename OUTPUT,
@@ -49,121 +239,30 @@ namespace ngraph
                      const float* output_scale = nullptr,
                      const OUTPUT* output_zero_point = nullptr)
             {
-                bool is_quantized = false;
-                if (input0_scale && input0_zero_point && input1_scale && input1_zero_point &&
-                    output_scale && output_zero_point)
-                {
-                    is_quantized = true;
-                }
-
-                auto old_mode = std::fegetround();
-                std::fesetround(FE_TONEAREST);
-                // Get the sizes of the dot axes. It's easiest to pull them from arg1 because
-                // they're right up front.
-                Shape dot_axis_sizes(reduction_axes_count);
-                std::copy(arg1_shape.begin(),
-                          arg1_shape.begin() + reduction_axes_count,
-                          dot_axis_sizes.begin());
-
-                CoordinateTransform arg0_transform(arg0_shape);
-                CoordinateTransform arg1_transform(arg1_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                // Create coordinate transforms for arg0 and arg1 that throw away the dotted axes.
                 size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
-                size_t arg1_projected_rank = arg1_shape.size() - reduction_axes_count;
-
-                Shape arg0_projected_shape(arg0_projected_rank);
-                std::copy(arg0_shape.begin(),
-                          arg0_shape.begin() + arg0_projected_rank,
-                          arg0_projected_shape.begin());
-
-                Shape arg1_projected_shape(arg1_projected_rank);
-                std::copy(arg1_shape.begin() + reduction_axes_count,
-                          arg1_shape.end(),
-                          arg1_projected_shape.begin());
-
-                CoordinateTransform arg0_projected_transform(arg0_projected_shape);
-                CoordinateTransform arg1_projected_transform(arg1_projected_shape);
-
-                // Create a coordinate transform that allows us to iterate over all possible values
-                // for the dotted axes.
-                CoordinateTransform dot_axes_transform(dot_axis_sizes);
-
-                for (const Coordinate& arg0_projected_coord : arg0_projected_transform)
-                {
-                    for (const Coordinate& arg1_projected_coord : arg1_projected_transform)
-                    {
-                        // The output coordinate is just the concatenation of the projected
-                        // coordinates.
-                        Coordinate out_coord(arg0_projected_coord.size() +
-                                             arg1_projected_coord.size());
+                size_t m = shape_size(Shape(arg0_shape.begin(),
+                                            arg0_shape.begin() + arg0_projected_rank));
+                size_t k = shape_size(
+                    Shape(arg1_shape.begin(), arg1_shape.begin() + reduction_axes_count));
+                size_t n =
+                    shape_size(Shape(arg1_shape.begin() + reduction_axes_count, arg1_shape.end()));
+                NGRAPH_CHECK(m * n == shape_size(out_shape),
+                             "Dot output shape ",
+                             out_shape,
+                             " does not match the inputs");
 
-                        auto out_coord_it = std::copy(arg0_projected_coord.begin(),
-                                                      arg0_projected_coord.end(),
-                                                      out_coord.begin());
-                        std::copy(
-                            arg1_projected_coord.begin(), arg1_projected_coord.end(), out_coord_it);
-
-                        // Zero out to start the sum.
-                        ACCUMULATION sum = 0;
-
-                        size_t out_index = output_transform.index(out_coord);
-
-                        // Walk along the dotted axes.
-                        Coordinate arg0_coord(arg0_shape.size());
-                        Coordinate arg1_coord(arg1_shape.size());
-                        auto arg0_it = std::copy(arg0_projected_coord.begin(),
-                                                 arg0_projected_coord.end(),
-                                                 arg0_coord.begin());
-                        for (const Coordinate& dot_axis_positions : dot_axes_transform)
-                        {
-                            // In order to find the points to multiply together, we need to inject
-                            // our current positions along the dotted axes back into the projected
-                            // arg0 and arg1 coordinates.
-                            std::copy(
-                                dot_axis_positions.begin(), dot_axis_positions.end(), arg0_it);
-
-                            auto arg1_it = std::copy(dot_axis_positions.begin(),
-                                                     dot_axis_positions.end(),
-                                                     arg1_coord.begin());
-                            std::copy(
-                                arg1_projected_coord.begin(), arg1_projected_coord.end(), arg1_it);
-
-                            // Multiply and add to the sum.
-                            if (is_quantized)
-                            {
-                                sum += (static_cast<ACCUMULATION>(
-                                            arg0[arg0_transform.index(arg0_coord)]) -
-                                        static_cast<ACCUMULATION>(*input0_zero_point)) *
-                                       (static_cast<ACCUMULATION>(
-                                            arg1[arg1_transform.index(arg1_coord)]) -
-                                        static_cast<ACCUMULATION>(*input1_zero_point));
-                            }
-                            else
-                            {
-                                sum += static_cast<ACCUMULATION>(
-                                           arg0[arg0_transform.index(arg0_coord)]) *
-                                       static_cast<ACCUMULATION>(
-                                           arg1[arg1_transform.index(arg1_coord)]);
-                            }
-                        }
-
-                        if (is_quantized)
-                        {
-                            float scale = *input0_scale * *input1_scale / *output_scale;
-                            // Write the sum back.
-                            out[out_index] =
-                                static_cast<OUTPUT>(std::round(static_cast<float>(sum) * scale)) +
-                                *output_zero_point;
-                        }
-                        else
-                        {
-                            out[out_index] = sum;
-                        }
-                    }
-                    std::fesetround(old_mode);
-                }
+                matmul<INPUT0, INPUT1, OUTPUT, ACCUMULATION>(arg0,
+                                                             arg1,
+                                                             out,
+                                                             m,
+                                                             k,
+                                                             n,
+                                                             input0_scale,
+                                                             input0_zero_point,
+                                                             input1_scale,
+                                                             input1_zero_point,
+                                                             output_scale,
+                                                             output_zero_point);
             }
         }
     }
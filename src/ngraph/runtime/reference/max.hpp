@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_range.hpp"
 
 namespace ngraph
 {
@@ -39,26 +41,22 @@ namespace ngraph
                                ? T(-std::numeric_limits<T>::infinity())
                                : std::numeric_limits<T>::min();
 
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T max = out[output_transform.index(output_coord)];
-                    if (x > max)
-                    {
-                        out[output_transform.index(output_coord)] = x;
-                    }
-                }
+                std::fill(out, out + shape_size(out_shape), minval);
+
+                parallel_reduction(in_shape, reduction_axes, [&](const StridedRange& range) {
+                    size_t run_length = range.get_run_length();
+                    std::ptrdiff_t out_step = range.get_run_stride_b();
+                    range.for_each([&](size_t in_index, size_t out_index) {
+                        for (size_t i = 0; i < run_length; i++)
+                        {
+                            T x = arg[in_index + i];
+                            if (x > out[out_index + i * out_step])
+                            {
+                                out[out_index + i * out_step] = x;
+                            }
+                        }
+                    });
+                });
             }
         }
     }
@@ -20,6 +20,7 @@
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 
 namespace ngraph
 {
@@ -133,9 +134,9 @@ namespace ngraph
             {
                 // At the outermost level we will walk over every output coordinate O.
                 CoordinateTransform output_transform(out_shape);
+                size_t window_size = shape_size(window_shape);
 
-                for (const Coordinate& out_coord : output_transform)
-                {
+                parallel_planes(out_shape, window_size, [&](const Coordinate& out_coord) {
                     // Our output coordinate O will have the form:
                     //
                     //   (N,chan,i_1,...,i_n)
@@ -218,7 +219,7 @@ namespace ngraph
                     }
 
                     out[output_transform.index(out_coord)] = result;
-                }
+                });
             }
         }
     }
@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_range.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
 
@@ -37,52 +39,42 @@ namespace ngraph
                       const Shape& out_shape,
                       const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), T(0));
                 std::vector<T> cs(shape_size(out_shape));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
+                parallel_reduction(in_shape, reduction_axes, [&](const StridedRange& range) {
+                    size_t run_length = range.get_run_length();
+                    std::ptrdiff_t out_step = range.get_run_stride_b();
+                    range.for_each([&](size_t in_index, size_t out_index) {
+                        for (size_t i = 0; i < run_length; i++)
+                        {
+                            T x = arg[in_index + i];
+                            T& z = out[out_index + i * out_step];
 
-                CoordinateTransform input_transform(in_shape);
-                std::map<size_t, int> index_to_count_map;
+                            if (is_finite(x) && is_finite(z))
+                            {
+                                T& c = cs[out_index + i * out_step];
+                                T t = z + (x - c);
+                                c = (t - z) - (x - c);
+                                z = t;
+                            }
+                            else
+                            {
+                                z = z + x;
+                            }
+                        }
+                    });
+                });
 
-                for (const Coordinate& input_coord : input_transform)
+                // Every output element reduces the same number of inputs
+                int count = 1;
+                for (size_t axis : reduction_axes)
                 {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-                    auto index = output_transform.index(output_coord);
-                    if (index_to_count_map.find(index) == index_to_count_map.end())
-                    {
-                        index_to_count_map[index] = 1;
-                    }
-                    else
-                    {
-                        index_to_count_map[index]++;
-                    }
-
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
+                    count *= static_cast<int>(in_shape[axis]);
                 }
-
-                for (const Coordinate& output_coord : output_transform)
+                for (size_t i = 0; i < shape_size(out_shape); i++)
                 {
-                    auto count = index_to_count_map[output_transform.index(output_coord)];
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] / count;
+                    out[i] = out[i] / count;
                 }
             }
         }
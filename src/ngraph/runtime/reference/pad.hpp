@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/pad.hpp" // for op::PadMode
+#include "ngraph/strided_range.hpp"
 
 namespace ngraph
 {
@@ -39,6 +41,44 @@ namespace ngraph
                      const CoordinateDiff& padding_above,
                      op::PadMode pad_mode)
             {
+                if (pad_mode == op::PadMode::CONSTANT)
+                {
+                    // Fill with the pad value, then copy the part of arg0 that lands inside the
+                    // output. Negative padding crops arg0.
+                    std::fill(out, out + shape_size(out_shape), *arg1);
+
+                    std::vector<std::ptrdiff_t> arg0_strides = StridedRange::strides(arg0_shape);
+                    std::vector<std::ptrdiff_t> out_strides = StridedRange::strides(out_shape);
+                    Shape copy_shape;
+                    std::ptrdiff_t arg0_offset = 0;
+                    std::ptrdiff_t out_offset = 0;
+                    for (size_t i = 0; i < arg0_shape.size(); i++)
+                    {
+                        std::ptrdiff_t first = std::max<std::ptrdiff_t>(0, -padding_below[i]);
+                        std::ptrdiff_t last =
+                            std::min<std::ptrdiff_t>(arg0_shape[i], out_shape[i] - padding_below[i]);
+                        if (last <= first)
+                        {
+                            return;
+                        }
+                        copy_shape.push_back(static_cast<size_t>(last - first));
+                        arg0_offset += first * arg0_strides[i];
+                        out_offset += (first + padding_below[i]) * out_strides[i];
+                    }
+
+                    StridedRange range(copy_shape, out_strides, arg0_strides, out_offset, arg0_offset);
+                    size_t run_length = range.get_run_length();
+                    std::ptrdiff_t out_step = range.get_run_stride_a();
+                    std::ptrdiff_t arg0_step = range.get_run_stride_b();
+                    range.for_each([&](size_t out_index, size_t arg0_index) {
+                        for (size_t j = 0; j < run_length; j++)
+                        {
+                            out[out_index + j * out_step] = arg0[arg0_index + j * arg0_step];
+                        }
+                    });
+                    return;
+                }
+
                 Coordinate input_start(arg0_shape.size(), 0); // start at (0,0,...,0)
                 Coordinate input_end = out_shape; // end at (d'0,d'1,...,d'n), the outer corner of
                                                   // the post-padding shape
@@ -0,0 +1,138 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/strided_range.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Calls f(range) for parts of StridedRange::reduction(in_shape, reduction_axes)
+            ///        that write disjoint outputs. The parts run in parallel when the first axis is
+            ///        not reduced. Every output element still sees its inputs in the same order, so
+            ///        results do not depend on the number of threads.
+            template <typename F>
+            void parallel_reduction(const Shape& in_shape, const AxisSet& reduction_axes, F f)
+            {
+                if (in_shape.empty() || reduction_axes.count(0) != 0 || in_shape[0] == 0)
+                {
+                    f(StridedRange::reduction(in_shape, reduction_axes));
+                    return;
+                }
+                parallel_for(in_shape[0],
+                             shape_size(in_shape) / in_shape[0],
+                             [&](size_t begin, size_t end) {
+                                 f(StridedRange::reduction(in_shape, reduction_axes, begin, end));
+                             });
+            }
+
+            /// \brief Calls f(index, projected_index, projected_stride, count) for every row of
+            ///        the innermost axis of a tensor of shape, in parallel. Element index + k of
+            ///        the row projects onto element projected_index + k * projected_stride of a
+            ///        tensor of project(shape, axes), such as the per-axis scales of a Quantize.
+            /// \param cost_per_element Approximate number of operations per element
+            template <typename F>
+            void parallel_projected_rows(const Shape& shape,
+                                         const AxisSet& axes,
+                                         size_t cost_per_element,
+                                         F f)
+            {
+                size_t count = shape_size(shape);
+                if (count == 0)
+                {
+                    return;
+                }
+                size_t rank = shape.size();
+                if (rank == 0)
+                {
+                    f(0, 0, 0, 1);
+                    return;
+                }
+                // Strides of the projected tensor, 0 on the axes which are projected away
+                std::vector<size_t> projected_strides(rank, 0);
+                size_t projected_stride = 1;
+                for (size_t i = rank; i-- > 0;)
+                {
+                    if (axes.count(i) != 0)
+                    {
+                        projected_strides[i] = projected_stride;
+                        projected_stride *= shape[i];
+                    }
+                }
+                size_t row_size = shape[rank - 1];
+                parallel_for(
+                    count / row_size, row_size * cost_per_element, [&](size_t begin, size_t end) {
+                        for (size_t row = begin; row < end; ++row)
+                        {
+                            size_t projected_index = 0;
+                            size_t rest = row;
+                            for (size_t i = rank - 1; i-- > 0;)
+                            {
+                                projected_index += (rest % shape[i]) * projected_strides[i];
+                                rest /= shape[i];
+                            }
+                            f(row * row_size,
+                              projected_index,
+                              projected_strides[rank - 1],
+                              row_size);
+                        }
+                    });
+            }
+
+            /// \brief Calls f(out_coord) for every coordinate of an output of out_shape. The
+            ///        (batch, channel) planes of the output are visited in parallel.
+            /// \param cost_per_element Approximate number of operations per output element
+            template <typename F>
+            void parallel_planes(const Shape& out_shape, size_t cost_per_element, F f)
+            {
+                if (shape_size(out_shape) == 0)
+                {
+                    return;
+                }
+                size_t channels = out_shape.at(1);
+                size_t planes = out_shape.at(0) * channels;
+                size_t plane_size = shape_size(out_shape) / planes;
+                parallel_for(planes, plane_size * cost_per_element, [&](size_t begin, size_t end) {
+                    for (size_t plane = begin; plane < end; plane++)
+                    {
+                        Coordinate plane_start(out_shape.size(), 0);
+                        Coordinate plane_end(out_shape);
+                        plane_start[0] = plane / channels;
+                        plane_end[0] = plane_start[0] + 1;
+                        plane_start[1] = plane % channels;
+                        plane_end[1] = plane_start[1] + 1;
+                        CoordinateTransform plane_transform(out_shape, plane_start, plane_end);
+                        for (const Coordinate& coord : plane_transform)
+                        {
+                            f(plane_transform.to_source_coordinate(coord));
+                        }
+                    }
+                });
+            }
+        }
+    }
+}
@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_range.hpp"
 
 namespace ngraph
 {
@@ -34,23 +36,19 @@ namespace ngraph
                          const Shape& out_shape,
                          const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 1;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    size_t output_index = output_transform.index(output_coord);
-
-                    out[output_index] = out[output_index] * arg[input_transform.index(input_coord)];
-                }
+                std::fill(out, out + shape_size(out_shape), T(1));
+
+                parallel_reduction(in_shape, reduction_axes, [&](const StridedRange& range) {
+                    size_t run_length = range.get_run_length();
+                    std::ptrdiff_t out_step = range.get_run_stride_b();
+                    range.for_each([&](size_t in_index, size_t out_index) {
+                        for (size_t i = 0; i < run_length; i++)
+                        {
+                            out[out_index + i * out_step] =
+                                out[out_index + i * out_step] * arg[in_index + i];
+                        }
+                    });
+                });
             }
         }
     }
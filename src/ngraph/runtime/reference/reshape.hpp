@@ -20,7 +20,8 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/check.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/strided_range.hpp"
 
 namespace ngraph
 {
@@ -35,30 +36,30 @@ namespace ngraph
                          const AxisVector& in_axis_order,
                          const Shape& out_shape)
             {
-                // Unfortunately we don't yet have a constructor for CoordinateTransform that lets
-                // us pass only source_space_shape
-                // and source_axis_order so we have to construct the defaults here.
-                Shape in_start_corner(in_shape.size(), 0); // (0,...0)
-                Strides in_strides(in_shape.size(), 1);    // (1,...,1)
+                NGRAPH_CHECK(in_axis_order.size() == in_shape.size());
 
-                CoordinateTransform input_transform(
-                    in_shape, in_start_corner, in_shape, in_strides, in_axis_order);
-                CoordinateTransform output_transform(out_shape);
-
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
+                // Walk the input in the permuted axis order; the output is written sequentially
+                Shape permuted_shape(in_shape.size());
+                std::vector<std::ptrdiff_t> in_strides = StridedRange::strides(in_shape);
+                std::vector<std::ptrdiff_t> arg_strides(in_shape.size());
+                for (size_t i = 0; i < in_shape.size(); i++)
                 {
-                    const Coordinate& output_coord = *output_it;
+                    permuted_shape[i] = in_shape[in_axis_order[i]];
+                    arg_strides[i] = in_strides[in_axis_order[i]];
+                }
 
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
+                NGRAPH_CHECK(shape_size(permuted_shape) == shape_size(out_shape));
 
-                    ++output_it;
-                }
+                StridedRange range(
+                    permuted_shape, StridedRange::strides(permuted_shape), arg_strides);
+                size_t run_length = range.get_run_length();
+                std::ptrdiff_t arg_step = range.get_run_stride_b();
+                range.for_each([&](size_t out_index, size_t arg_index) {
+                    for (size_t i = 0; i < run_length; i++)
+                    {
+                        out[out_index + i] = arg[arg_index + i * arg_step];
+                    }
+                });
             }
         }
     }
@@ -18,7 +18,7 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_range.hpp"
 
 namespace ngraph
 {
@@ -34,24 +34,29 @@ namespace ngraph
                          const AxisSet& reversed_axes)
             {
                 // In fact arg_shape == out_shape, but we'll use both for stylistic consistency with
-                // other kernels.
-                CoordinateTransform arg_transform(arg_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                for (Coordinate out_coord : output_transform)
+                // other kernels. Reversed axes walk the input backwards from their last element.
+                std::vector<std::ptrdiff_t> arg_strides = StridedRange::strides(arg_shape);
+                std::ptrdiff_t arg_offset = 0;
+                for (size_t axis : reversed_axes)
                 {
-                    Coordinate arg_coord = out_coord;
-
-                    for (size_t i = 0; i < arg_coord.size(); i++)
+                    if (arg_shape[axis] != 0)
                     {
-                        if (reversed_axes.count(i) != 0)
-                        {
-                            arg_coord[i] = arg_shape[i] - arg_coord[i] - 1;
-                        }
+                        arg_offset +=
+                            static_cast<std::ptrdiff_t>(arg_shape[axis] - 1) * arg_strides[axis];
                     }
-
-                    out[output_transform.index(out_coord)] = arg[arg_transform.index(arg_coord)];
+                    arg_strides[axis] = -arg_strides[axis];
                 }
+
+                StridedRange range(
+                    out_shape, StridedRange::strides(out_shape), arg_strides, 0, arg_offset);
+                size_t run_length = range.get_run_length();
+                std::ptrdiff_t arg_step = range.get_run_stride_b();
+                range.for_each([&](size_t out_index, size_t arg_index) {
+                    for (size_t i = 0; i < run_length; i++)
+                    {
+                        out[out_index + i] = arg[arg_index + i * arg_step];
+                    }
+                });
             }
         }
     }
@@ -19,7 +19,9 @@
 #include <cmath>
 
 #include "ngraph/check.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/strided_range.hpp"
+#include "ngraph/strides.hpp"
 
 namespace ngraph
 {
@@ -36,22 +38,33 @@ namespace ngraph
                        const Strides& strides,
                        const Shape& out_shape)
             {
-                CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
+                NGRAPH_CHECK(arg_shape.size() == out_shape.size() &&
+                             lower_bounds.size() == out_shape.size() &&
+                             strides.size() == out_shape.size());
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
-
-                for (const Coordinate& in_coord : input_transform)
+                // Walk the output, stepping through the input by the slice strides
+                std::vector<std::ptrdiff_t> in_strides = StridedRange::strides(arg_shape);
+                std::vector<std::ptrdiff_t> arg_strides(out_shape.size());
+                std::ptrdiff_t arg_offset = 0;
+                for (size_t axis = 0; axis < out_shape.size(); axis++)
                 {
-                    const Coordinate& out_coord = *output_it;
-
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
-
-                    ++output_it;
+                    NGRAPH_CHECK(out_shape[axis] == 0 ||
+                                 lower_bounds[axis] + (out_shape[axis] - 1) * strides[axis] <
+                                     upper_bounds[axis]);
+                    arg_offset += lower_bounds[axis] * in_strides[axis];
+                    arg_strides[axis] = in_strides[axis] * strides[axis];
                 }
+
+                StridedRange range(
+                    out_shape, StridedRange::strides(out_shape), arg_strides, 0, arg_offset);
+                size_t run_length = range.get_run_length();
+                std::ptrdiff_t arg_step = range.get_run_stride_b();
+                range.for_each([&](size_t out_index, size_t arg_index) {
+                    for (size_t i = 0; i < run_length; i++)
+                    {
+                        out[out_index + i] = arg[arg_index + i * arg_step];
+                    }
+                });
             }
         }
     }
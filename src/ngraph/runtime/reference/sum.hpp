@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_range.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
 
@@ -59,36 +61,32 @@ namespace ngraph
                      const Shape& out_shape,
                      const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), T(0));
                 std::vector<T> cs(shape_size(out_shape));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
+                parallel_reduction(in_shape, reduction_axes, [&](const StridedRange& range) {
+                    size_t run_length = range.get_run_length();
+                    std::ptrdiff_t out_step = range.get_run_stride_b();
+                    range.for_each([&](size_t in_index, size_t out_index) {
+                        for (size_t i = 0; i < run_length; i++)
+                        {
+                            T x = arg[in_index + i];
+                            T& z = out[out_index + i * out_step];
 
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
-                }
+                            if (is_finite(x) && is_finite(z))
+                            {
+                                T& c = cs[out_index + i * out_step];
+                                T t = z + (x - c);
+                                c = (t - z) - (x - c);
+                                z = t;
+                            }
+                            else
+                            {
+                                z = z + x;
+                            }
+                        }
+                    });
+                });
             }
         }
     }
@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief An AlignedBuffer over memory owned by another object, which is kept alive as
+        ///        long as the buffer. Nothing is allocated or copied.
+        template <typename T>
+        class SharedBuffer : public AlignedBuffer
+        {
+        public:
+            /// \param data Start of the memory, which must stay valid while owner is alive
+            /// \param byte_size Size of the memory
+            /// \param owner Object owning the memory, typically a shared_ptr
+            SharedBuffer(char* data, size_t byte_size, const T& owner)
+                : m_owner(owner)
+            {
+                m_allocated_buffer = data;
+                m_aligned_buffer = data;
+                m_byte_size = byte_size;
+            }
+
+            ~SharedBuffer() override
+            {
+                // The memory belongs to m_owner
+                m_allocated_buffer = nullptr;
+                m_aligned_buffer = nullptr;
+                m_byte_size = 0;
+            }
+
+        private:
+            T m_owner;
+        };
+    }
+}
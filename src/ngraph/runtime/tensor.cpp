@@ -14,10 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <map>
+
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/type/element_type.hpp"
 
 using namespace ngraph;
@@ -78,6 +82,147 @@ void runtime::Tensor::set_stale(bool val)
     m_stale = val;
 }
 
+future<void> runtime::Tensor::begin_write(const void* p, size_t n)
+{
+    auto result = make_shared<promise<void>>();
+    start_async_operation({{this, true}}, [this, p, n, result]() {
+        try
+        {
+            write(p, n);
+        }
+        catch (...)
+        {
+            result->set_exception(current_exception());
+            throw;
+        }
+        result->set_value();
+    });
+    return result->get_future();
+}
+
+future<void> runtime::Tensor::begin_read(void* p, size_t n)
+{
+    auto result = make_shared<promise<void>>();
+    start_async_operation({{this, false}}, [this, p, n, result]() {
+        try
+        {
+            read(p, n);
+        }
+        catch (...)
+        {
+            result->set_exception(current_exception());
+            throw;
+        }
+        result->set_value();
+    });
+    return result->get_future();
+}
+
+void runtime::Tensor::wait_for_read_ready()
+{
+    for (const shared_future<void>& dependency : get_async_dependencies(false))
+    {
+        dependency.wait();
+    }
+}
+
+void runtime::Tensor::wait_for_write_ready()
+{
+    for (const shared_future<void>& dependency : get_async_dependencies(true))
+    {
+        dependency.wait();
+    }
+}
+
+vector<shared_future<void>> runtime::Tensor::get_async_dependencies(bool write) const
+{
+    lock_guard<mutex> lock(m_async_mutex);
+    vector<shared_future<void>> rc;
+    if (m_pending_write.valid())
+    {
+        rc.push_back(m_pending_write);
+    }
+    if (write)
+    {
+        rc.insert(rc.end(), m_pending_reads.begin(), m_pending_reads.end());
+    }
+    return rc;
+}
+
+void runtime::Tensor::start_async_operation(const vector<pair<Tensor*, bool>>& accesses,
+                                            function<void()> operation)
+{
+    // One entry per tensor, in address order so that concurrent registrations lock the tensors
+    // they share in the same order
+    map<Tensor*, bool> tensors;
+    for (const pair<Tensor*, bool>& access : accesses)
+    {
+        tensors[access.first] = tensors[access.first] || access.second;
+    }
+    vector<unique_lock<mutex>> locks;
+    for (const pair<Tensor* const, bool>& tensor : tensors)
+    {
+        locks.emplace_back(tensor.first->m_async_mutex);
+    }
+
+    vector<shared_future<void>> dependencies;
+    for (const pair<Tensor* const, bool>& tensor : tensors)
+    {
+        Tensor* t = tensor.first;
+        if (t->m_pending_write.valid())
+        {
+            dependencies.push_back(t->m_pending_write);
+        }
+        if (tensor.second)
+        {
+            dependencies.insert(
+                dependencies.end(), t->m_pending_reads.begin(), t->m_pending_reads.end());
+        }
+    }
+
+    auto done = make_shared<promise<void>>();
+    shared_future<void> done_future = done->get_future().share();
+    for (const pair<Tensor* const, bool>& tensor : tensors)
+    {
+        Tensor* t = tensor.first;
+        if (tensor.second)
+        {
+            // A writer waits for all earlier readers, so they no longer need to be tracked
+            t->m_pending_write = done_future;
+            t->m_pending_reads.clear();
+        }
+        else
+        {
+            t->m_pending_reads.erase(remove_if(t->m_pending_reads.begin(),
+                                               t->m_pending_reads.end(),
+                                               [](const shared_future<void>& f) {
+                                                   return f.wait_for(chrono::seconds(0)) ==
+                                                          future_status::ready;
+                                               }),
+                                     t->m_pending_reads.end());
+            t->m_pending_reads.push_back(done_future);
+        }
+    }
+
+    // Submitting while the tensors are locked keeps the queue in dependency order, so an
+    // operation never waits on one queued behind it
+    TaskQueue::get_async_queue().submit([dependencies, done, operation]() {
+        try
+        {
+            for (const shared_future<void>& dependency : dependencies)
+            {
+                dependency.wait();
+            }
+            operation();
+            done->set_value();
+        }
+        catch (...)
+        {
+            done->set_exception(current_exception());
+        }
+    });
+}
+
 void runtime::Tensor::copy_from(const ngraph::runtime::Tensor& source)
 {
     if (get_element_count() != source.get_element_count())
@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
@@ -46,7 +50,14 @@ namespace ngraph
 
         public:
             virtual ~Tensor() {}
-            Tensor& operator=(const Tensor&) = default;
+            /// \brief Copies the descriptor and staleness, not the pending asynchronous
+            ///    operations
+            Tensor& operator=(const Tensor& other)
+            {
+                m_descriptor = other.m_descriptor;
+                m_stale = other.m_stale;
+                return *this;
+            }
 
             /// \brief Get tensor shape
             /// \return const reference to a Shape
@@ -93,22 +104,60 @@ namespace ngraph
             /// changed.
             void set_stale(bool val);
 
-            /// \brief Write bytes directly into the tensor
+            /// \brief Write bytes directly into the tensor. Does not wait for asynchronous
+            ///    operations, call wait_for_write_ready() first if any may be pending.
             /// \param p Pointer to source of data
             /// \param n Number of bytes to write, must be integral number of elements.
             virtual void write(const void* p, size_t n) = 0;
 
-            /// \brief Read bytes directly from the tensor
+            /// \brief Read bytes directly from the tensor. Does not wait for asynchronous
+            ///    operations, call wait_for_read_ready() first if any may be pending.
             /// \param p Pointer to destination for data
             /// \param n Number of bytes to read, must be integral number of elements.
             virtual void read(void* p, size_t n) const = 0;
 
+            /// \brief Start writing bytes into the tensor without blocking the caller.
+            ///    The write is ordered after every pending asynchronous operation on this tensor.
+            /// \param p Pointer to source of data, must stay valid until the write completes.
+            /// \param n Number of bytes to write, must be integral number of elements.
+            /// \returns A future which becomes ready once the write has completed. The tensor
+            ///    must outlive the write.
+            std::future<void> begin_write(const void* p, size_t n);
+
+            /// \brief Start reading bytes from the tensor without blocking the caller.
+            ///    The read is ordered after every pending asynchronous write of this tensor,
+            ///    including executions started with Executable::begin_execute.
+            /// \param p Pointer to destination for data, must stay valid until the read completes.
+            /// \param n Number of bytes to read, must be integral number of elements.
+            /// \returns A future which becomes ready once the read has completed. The tensor
+            ///    must outlive the read.
+            std::future<void> begin_read(void* p, size_t n);
+
             /// \brief check tensor for new data, call may block.
+            ///    Waits until every pending asynchronous write of this tensor has completed.
             ///    backends may use this to ensure tensor is updated (eg: lazy eval).
-            virtual void wait_for_read_ready() {}
+            virtual void wait_for_read_ready();
             /// \brief notify tensor of new data, call may block.
-            ///    backends may use this as indication of new data in tensor.
-            virtual void wait_for_write_ready() {}
+            ///    Waits until every pending asynchronous read and write of this tensor has
+            ///    completed. backends may use this as indication of new data in tensor.
+            virtual void wait_for_write_ready();
+
+            /// \brief Get the pending asynchronous operations an access to this tensor must be
+            ///    ordered after.
+            /// \param write true if the access modifies the tensor, false if it only reads it
+            /// \returns futures of the pending operations
+            std::vector<std::shared_future<void>> get_async_dependencies(bool write) const;
+
+            /// \brief Run an operation on TaskQueue::get_async_queue() once the pending
+            ///    asynchronous operations on the tensors it accesses are done, and record it as
+            ///    pending on those tensors. Registration is atomic with respect to other
+            ///    asynchronous operations on the same tensors.
+            /// \param accesses The tensors the operation accesses, each with true if the
+            ///    operation modifies it. A tensor may appear more than once.
+            /// \param operation Called on a worker thread. It must report its own errors, an
+            ///    exception it throws is dropped.
+            static void start_async_operation(const std::vector<std::pair<Tensor*, bool>>& accesses,
+                                              std::function<void()> operation);
             /// \brief copy bytes directly from source to this tensor
             /// \param source The source tensor
             virtual void copy_from(const ngraph::runtime::Tensor& source) NGRAPH_DEPRECATED(
@@ -118,6 +167,10 @@ namespace ngraph
         protected:
             std::shared_ptr<ngraph::descriptor::Tensor> m_descriptor;
             bool m_stale;
+            // Guards the pending operations
+            mutable std::mutex m_async_mutex;
+            std::shared_future<void> m_pending_write;
+            std::vector<std::shared_future<void>> m_pending_reads;
         };
     }
 }
@@ -0,0 +1,302 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    const string s_intra_op_parallelism = "intra_op_parallelism";
+
+    thread_local runtime::ThreadPool* s_current_pool = nullptr;
+
+    // Work below this many elementary operations per chunk is not worth handing to a worker
+    constexpr size_t s_min_chunk_cost = 1 << 15;
+}
+
+void runtime::parallel_for(size_t count,
+                           size_t cost_per_item,
+                           const function<void(size_t begin, size_t end)>& f)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    ThreadPool* pool = s_current_pool;
+    size_t chunk_count = 1;
+    if (pool != nullptr)
+    {
+        chunk_count = min({count,
+                           pool->get_thread_count() * 4,
+                           count * max<size_t>(cost_per_item, 1) / s_min_chunk_cost});
+    }
+    if (chunk_count < 2 || !pool->try_parallel_for(count, chunk_count, f))
+    {
+        f(0, count);
+    }
+}
+
+runtime::ThreadPool::ThreadPool(size_t thread_count)
+    : m_thread_count(max<size_t>(thread_count, 1))
+{
+}
+
+runtime::ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_work_available.notify_all();
+    for (thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+size_t runtime::ThreadPool::get_default_thread_count()
+{
+    int32_t thread_count = getenv_int("NGRAPH_INTRA_OP_PARALLELISM", 0);
+    if (thread_count > 0)
+    {
+        return thread_count;
+    }
+    return max<size_t>(thread::hardware_concurrency(), 1);
+}
+
+bool runtime::ThreadPool::try_parallel_for(size_t count,
+                                           size_t chunk_count,
+                                           const function<void(size_t begin, size_t end)>& f)
+{
+    unique_lock<mutex> submit(m_submit_mutex, try_to_lock);
+    if (!submit.owns_lock())
+    {
+        return false;
+    }
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_workers.empty())
+        {
+            // The workers wait for m_mutex, then find the job of the next generation
+            for (size_t i = 1; i < m_thread_count; i++)
+            {
+                m_workers.emplace_back(&ThreadPool::worker, this, m_generation);
+            }
+        }
+        m_job = &f;
+        m_count = count;
+        m_chunk_count = chunk_count;
+        m_next_chunk = 0;
+        m_busy_workers = m_workers.size();
+        m_generation++;
+    }
+    m_work_available.notify_all();
+
+    {
+        // Nested parallel_for calls from f run inline
+        Scope inline_scope(nullptr);
+        run_chunks();
+    }
+
+    unique_lock<mutex> lock(m_mutex);
+    m_work_done.wait(lock, [this]() { return m_busy_workers == 0; });
+    m_job = nullptr;
+    exception_ptr exception = m_exception;
+    m_exception = nullptr;
+    lock.unlock();
+    if (exception)
+    {
+        rethrow_exception(exception);
+    }
+    return true;
+}
+
+void runtime::ThreadPool::run_chunks()
+{
+    while (true)
+    {
+        size_t chunk;
+        {
+            lock_guard<mutex> lock(m_mutex);
+            if (m_next_chunk >= m_chunk_count)
+            {
+                return;
+            }
+            chunk = m_next_chunk++;
+        }
+        size_t begin = chunk * m_count / m_chunk_count;
+        size_t end = (chunk + 1) * m_count / m_chunk_count;
+        try
+        {
+            (*m_job)(begin, end);
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(m_mutex);
+            if (!m_exception)
+            {
+                m_exception = current_exception();
+            }
+        }
+    }
+}
+
+void runtime::ThreadPool::worker(size_t generation)
+{
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_work_available.wait(
+                lock, [this, generation]() { return m_stop || m_generation != generation; });
+            if (m_stop)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+        run_chunks();
+        {
+            lock_guard<mutex> lock(m_mutex);
+            if (--m_busy_workers == 0)
+            {
+                m_work_done.notify_all();
+            }
+        }
+    }
+}
+
+runtime::ThreadPool::Scope::Scope(ThreadPool* pool)
+    : m_previous(s_current_pool)
+{
+    s_current_pool = pool;
+}
+
+runtime::ThreadPool::Scope::~Scope()
+{
+    s_current_pool = m_previous;
+}
+
+runtime::ThreadPool* runtime::ThreadPool::get_current()
+{
+    return s_current_pool;
+}
+
+bool runtime::ThreadPoolConfig::set_config(const map<string, string>& config, string& error)
+{
+    auto it = config.find(s_intra_op_parallelism);
+    if (it == config.end())
+    {
+        return true;
+    }
+    int64_t thread_count = 0;
+    try
+    {
+        thread_count = parse_string<int64_t>(it->second);
+    }
+    catch (const exception& e)
+    {
+        error = e.what();
+        return false;
+    }
+    if (thread_count <= 0)
+    {
+        error = s_intra_op_parallelism + " must be a positive number of threads";
+        return false;
+    }
+    lock_guard<mutex> lock(m_mutex);
+    m_thread_count = static_cast<size_t>(thread_count);
+    // Executables compiled so far keep the pool they were given
+    m_thread_pool = nullptr;
+    return true;
+}
+
+bool runtime::ThreadPoolConfig::has_config(const map<string, string>& config)
+{
+    return config.find(s_intra_op_parallelism) != config.end();
+}
+
+shared_ptr<runtime::ThreadPool> runtime::ThreadPoolConfig::get_thread_pool()
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (!m_thread_pool)
+    {
+        m_thread_pool = make_shared<ThreadPool>(m_thread_count);
+    }
+    return m_thread_pool;
+}
+
+runtime::TaskQueue::TaskQueue(size_t thread_count)
+{
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        m_workers.emplace_back(&TaskQueue::worker, this);
+    }
+}
+
+runtime::TaskQueue::~TaskQueue()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_task_available.notify_all();
+    for (thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void runtime::TaskQueue::submit(function<void()> task)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_tasks.push_back(move(task));
+    }
+    m_task_available.notify_one();
+}
+
+runtime::TaskQueue& runtime::TaskQueue::get_async_queue()
+{
+    static TaskQueue s_queue(max<size_t>(thread::hardware_concurrency(), 2));
+    return s_queue;
+}
+
+void runtime::TaskQueue::worker()
+{
+    while (true)
+    {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_task_available.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+            // Pending tasks still run so their futures become ready
+            if (m_tasks.empty())
+            {
+                return;
+            }
+            task = move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+    }
+}
@@ -0,0 +1,166 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ThreadPool;
+        class ThreadPoolConfig;
+        class TaskQueue;
+
+        /// \brief Calls f(begin, end) over disjoint chunks covering [0, count), in parallel on
+        ///        the ThreadPool made current on this thread by a ThreadPool::Scope. Runs
+        ///        f(0, count) inline when there is no current pool, when the pool is busy, or when
+        ///        count * cost_per_item is too small to be worth splitting.
+        /// \param count Number of items
+        /// \param cost_per_item Approximate number of elementary operations per item
+        /// \param f Processes the items in [begin, end)
+        NGRAPH_API
+        void parallel_for(size_t count,
+                          size_t cost_per_item,
+                          const std::function<void(size_t begin, size_t end)>& f);
+    }
+}
+
+/// \brief A fixed set of worker threads that execute the chunks of one parallel_for at a time.
+///        The calling thread also executes chunks, so a pool of n threads starts n - 1 workers.
+///        They start with the first parallel_for split into chunks, so a pool that only ever runs
+///        small work inline costs no threads.
+class NGRAPH_API ngraph::runtime::ThreadPool
+{
+public:
+    /// \param thread_count Number of threads that execute a parallel_for, including the caller
+    explicit ThreadPool(size_t thread_count = get_default_thread_count());
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t get_thread_count() const { return m_thread_count; }
+    /// \brief Value of NGRAPH_INTRA_OP_PARALLELISM, or the number of hardware threads when it is
+    ///        not set
+    static size_t get_default_thread_count();
+
+    /// \brief Runs f over chunks of [0, count) on the pool and the calling thread. Returns false
+    ///        without running anything if another parallel_for is already using the pool.
+    ///        Rethrows the first exception thrown by f.
+    bool try_parallel_for(size_t count,
+                          size_t chunk_count,
+                          const std::function<void(size_t begin, size_t end)>& f);
+
+    /// \brief Makes a pool the target of runtime::parallel_for on the constructing thread for
+    ///        the lifetime of the Scope. A null pool makes parallel_for run inline.
+    class NGRAPH_API Scope
+    {
+    public:
+        explicit Scope(ThreadPool* pool);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ThreadPool* m_previous;
+    };
+
+    /// \brief The pool made current on this thread, or nullptr
+    static ThreadPool* get_current();
+
+private:
+    void worker(size_t generation);
+    void run_chunks();
+
+    size_t m_thread_count;
+    std::vector<std::thread> m_workers;
+    std::mutex m_submit_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_work_available;
+    std::condition_variable m_work_done;
+    bool m_stop{false};
+    // Incremented for every parallel_for so workers can tell a new job from the one they did
+    size_t m_generation{0};
+    const std::function<void(size_t, size_t)>* m_job{nullptr};
+    size_t m_count{0};
+    size_t m_chunk_count{0};
+    size_t m_next_chunk{0};
+    size_t m_busy_workers{0};
+    std::exception_ptr m_exception;
+};
+
+/// \brief The intra-op ThreadPool a backend hands to the executables it compiles, sized by the
+///        "intra_op_parallelism" backend configuration.
+class NGRAPH_API ngraph::runtime::ThreadPoolConfig
+{
+public:
+    /// \brief Applies the "intra_op_parallelism" entry of config, if there is one. Executables
+    ///        compiled before keep the pool they were given.
+    /// \returns false and sets error if the entry is not a positive number of threads
+    bool set_config(const std::map<std::string, std::string>& config, std::string& error);
+
+    /// \returns true if config has an entry handled by set_config
+    static bool has_config(const std::map<std::string, std::string>& config);
+
+    /// \returns The pool for newly compiled executables, created on first use
+    std::shared_ptr<ThreadPool> get_thread_pool();
+
+private:
+    std::mutex m_mutex;
+    size_t m_thread_count{ThreadPool::get_default_thread_count()};
+    std::shared_ptr<ThreadPool> m_thread_pool;
+};
+
+/// \brief A fixed set of worker threads that run submitted tasks in submission order.
+class NGRAPH_API ngraph::runtime::TaskQueue
+{
+public:
+    /// \param thread_count Number of worker threads
+    explicit TaskQueue(size_t thread_count);
+    ~TaskQueue();
+    TaskQueue(const TaskQueue&) = delete;
+    TaskQueue& operator=(const TaskQueue&) = delete;
+
+    /// \brief Queues task. Tasks start in the order they are submitted.
+    void submit(std::function<void()> task);
+
+    /// \brief The queue running Tensor::begin_read, Tensor::begin_write and
+    ///        Executable::begin_execute, with one worker per hardware thread and at least two.
+    ///        These tasks may block on operations submitted before them, which always run first.
+    static TaskQueue& get_async_queue();
+
+private:
+    void worker();
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_task_available;
+    std::deque<std::function<void()>> m_tasks;
+    bool m_stop{false};
+};
@@ -14,11 +14,21 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <queue>
 #include <stack>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "ngraph/cpio.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
@@ -26,6 +36,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/provenance.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
@@ -122,11 +133,14 @@ public:
     json serialize_tensor_iterator_output_description(
         const std::shared_ptr<op::TensorIterator::OutputDescription>&);
 
+    /// Constants whose data was left out of the json because of set_binary_constant_data
+    const vector<const op::Constant*>& get_binary_constants() const { return m_binary_constants; }
 protected:
     size_t m_indent{0};
     bool m_serialize_output_shapes{false};
     bool m_binary_constant_data{false};
     json m_json_nodes;
+    vector<const op::Constant*> m_binary_constants;
 };
 
 class JSONDeserializer
@@ -360,10 +374,219 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
+// Binary model format. The header is followed by the data of every constant and then by the
+// graph, which is the compact json serialization with the constant data left out and a
+// "constants" object mapping each constant's name to the offset and size of its data. Constants
+// of a page or more start on a page boundary, smaller ones on a cache line. Integers are in the
+// byte order of the machine that wrote the file.
+//
+// The graph is json text rather than a binary encoding of it because nlohmann::json parses text
+// faster than it decodes CBOR, and the graph is small next to the constant data.
+namespace
+{
+    const char s_binary_magic[8] = {'n', 'G', 'r', 'a', 'p', 'h', 'B', '\0'};
+    const uint32_t s_binary_version = 1;
+    const uint32_t s_binary_alignment = 4096;
+    const uint32_t s_binary_small_alignment = 64;
+
+    struct BinaryHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t alignment;
+        uint64_t graph_offset;
+        uint64_t graph_size;
+    };
+
+    // A model file mapped into memory. The mapping is private, so writing to the data of a
+    // constant copies the page instead of changing the file.
+    class MappedFile
+    {
+    public:
+        MappedFile(const string& path)
+        {
+#ifdef _WIN32
+            // No mapping on Windows, the file is read instead
+            ifstream in(path, ios_base::binary | ios_base::in);
+            NGRAPH_CHECK(in, "Unable to open '", path, "'");
+            in.seekg(0, ios_base::end);
+            m_size = static_cast<size_t>(in.tellg());
+            in.seekg(0, ios_base::beg);
+            m_buffer.reset(new runtime::AlignedBuffer(m_size, s_binary_alignment));
+            in.read(m_buffer->get_ptr<char>(), m_size);
+            m_data = m_buffer->get_ptr<char>();
+#else
+            int fd = open(path.c_str(), O_RDONLY);
+            NGRAPH_CHECK(fd >= 0, "Unable to open '", path, "'");
+            struct stat file_stat;
+            if (fstat(fd, &file_stat) != 0)
+            {
+                close(fd);
+                throw ngraph_error("Unable to stat '" + path + "'");
+            }
+            m_size = static_cast<size_t>(file_stat.st_size);
+            void* data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            close(fd);
+            NGRAPH_CHECK(data != MAP_FAILED, "Unable to map '", path, "'");
+            m_data = static_cast<char*>(data);
+#endif
+        }
+
+        ~MappedFile()
+        {
+#ifndef _WIN32
+            munmap(m_data, m_size);
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        char* get_data() const { return m_data; }
+        size_t get_size() const { return m_size; }
+    private:
+        char* m_data;
+        size_t m_size;
+#ifdef _WIN32
+        unique_ptr<runtime::AlignedBuffer> m_buffer;
+#endif
+    };
+}
+
+static bool is_binary_model(istream& in)
+{
+    auto position = in.tellg();
+    char magic[sizeof(s_binary_magic)];
+    in.read(magic, sizeof(magic));
+    bool rc = in.gcount() == sizeof(magic) && memcmp(magic, s_binary_magic, sizeof(magic)) == 0;
+    in.clear();
+    in.seekg(position);
+    return rc;
+}
+
+// Deserializes a binary model held in memory. make_buffer wraps a byte range of that memory
+// for a constant without copying it.
+static shared_ptr<Function> deserialize_binary_data(
+    const char* data,
+    size_t size,
+    const function<shared_ptr<runtime::AlignedBuffer>(size_t offset, size_t size)>& make_buffer)
+{
+    BinaryHeader header;
+    NGRAPH_CHECK(size >= sizeof(header) &&
+                     memcmp(data, s_binary_magic, sizeof(s_binary_magic)) == 0,
+                 "Not a binary model");
+    memcpy(&header, data, sizeof(header));
+    NGRAPH_CHECK(header.version == s_binary_version,
+                 "Unsupported binary model version ",
+                 header.version);
+    NGRAPH_CHECK(header.graph_offset <= size && header.graph_size <= size - header.graph_offset,
+                 "Truncated binary model");
+
+    const char* graph = data + header.graph_offset;
+    json js = json::parse(graph, graph + header.graph_size);
+    const json& constants = js.at("constants");
+    JSONDeserializer deserializer;
+    deserializer.set_const_data_callback(
+        [&](const string& const_name, const element::Type& et, const Shape& shape) {
+            const json& location = constants.at(const_name);
+            size_t offset = location.at(0).get<size_t>();
+            size_t byte_size = location.at(1).get<size_t>();
+            NGRAPH_CHECK(byte_size == shape_size(shape) * et.size() && offset <= size &&
+                             byte_size <= size - offset,
+                         "Invalid data for constant ",
+                         const_name);
+            return make_shared<op::Constant>(et, shape, make_buffer(offset, byte_size));
+        });
+    shared_ptr<Function> rc;
+    for (json& func : js.at("functions"))
+    {
+        rc = deserializer.deserialize_function(move(func));
+    }
+    return rc;
+}
+
+void ngraph::serialize_binary(const string& path, shared_ptr<Function> func)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize_binary(out, func);
+}
+
+void ngraph::serialize_binary(ostream& out, shared_ptr<Function> func)
+{
+    JSONSerializer serializer;
+    serializer.set_binary_constant_data(true);
+    serializer.set_serialize_output_shapes(s_serialize_output_shapes_enabled);
+
+    json js;
+    js["functions"].push_back(serializer.serialize_function(*func));
+    js["constants"] = json::object();
+    const auto& constants = serializer.get_binary_constants();
+    vector<uint64_t> offsets;
+    uint64_t offset = sizeof(BinaryHeader);
+    for (const op::Constant* constant : constants)
+    {
+        uint64_t byte_size =
+            shape_size(constant->get_shape()) * constant->get_element_type().size();
+        offset = round_up(offset,
+                          byte_size < s_binary_alignment ? s_binary_small_alignment
+                                                         : s_binary_alignment);
+        js["constants"][constant->get_name()] = {offset, byte_size};
+        offsets.push_back(offset);
+        offset += byte_size;
+    }
+    string graph = js.dump();
+
+    BinaryHeader header;
+    memcpy(header.magic, s_binary_magic, sizeof(s_binary_magic));
+    header.version = s_binary_version;
+    header.alignment = s_binary_alignment;
+    header.graph_offset = offset;
+    header.graph_size = graph.size();
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    uint64_t position = sizeof(header);
+    const vector<char> padding(s_binary_alignment, 0);
+    for (size_t i = 0; i < constants.size(); i++)
+    {
+        out.write(padding.data(), offsets[i] - position);
+        size_t byte_size =
+            shape_size(constants[i]->get_shape()) * constants[i]->get_element_type().size();
+        out.write(static_cast<const char*>(constants[i]->get_data_ptr()), byte_size);
+        position = offsets[i] + byte_size;
+    }
+    out.write(graph.data(), graph.size());
+    NGRAPH_CHECK(out, "Failed to write binary model");
+}
+
+shared_ptr<Function> ngraph::deserialize_binary(const string& path)
+{
+    auto file = make_shared<MappedFile>(path);
+    return deserialize_binary_data(
+        file->get_data(), file->get_size(), [&file](size_t offset, size_t size) {
+            return make_shared<runtime::SharedBuffer<shared_ptr<MappedFile>>>(
+                file->get_data() + offset, size, file);
+        });
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
+    if (is_binary_model(in))
+    {
+        // Streams cannot be mapped, so the whole model is read and constants share the copy
+        auto start = in.tellg();
+        in.seekg(0, ios_base::end);
+        size_t size = static_cast<size_t>(in.tellg() - start);
+        in.seekg(start);
+        auto buffer = make_shared<runtime::AlignedBuffer>(size, s_binary_alignment);
+        in.read(buffer->get_ptr<char>(), size);
+        rc = deserialize_binary_data(
+            buffer->get_ptr<char>(), size, [&buffer](size_t offset, size_t byte_size) {
+                return make_shared<runtime::SharedBuffer<shared_ptr<runtime::AlignedBuffer>>>(
+                    buffer->get_ptr<char>() + offset, byte_size, buffer);
+            });
+    }
+    else if (cpio::is_cpio(in))
     {
         cpio::Reader reader(in);
         vector<cpio::FileInfo> file_info = reader.get_file_info();
@@ -416,7 +639,14 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     {
         // s is a file and not a json string
         ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        if (is_binary_model(in))
+        {
+            rc = deserialize_binary(s);
+        }
+        else
+        {
+            rc = deserialize(in);
+        }
     }
     else
     {
@@ -1045,8 +1275,15 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
             auto element_type = read_element_type(type_node_js.at("element_type"));
             auto shape = type_node_js.at("shape");
-            auto value = node_js.at("value").get<vector<string>>();
-            node = make_shared<op::Constant>(element_type, shape, value);
+            if (m_const_data_callback && !has_key(node_js, "value"))
+            {
+                node = m_const_data_callback(node_name, element_type, shape);
+            }
+            else
+            {
+                auto value = node_js.at("value").get<vector<string>>();
+                node = make_shared<op::Constant>(element_type, shape, value);
+            }
             break;
         }
         case OP_TYPEID::Convert:
@@ -3347,7 +3584,12 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant:
     {
         auto tmp = static_cast<const op::Constant*>(&n);
-        if (tmp->get_all_data_elements_bitwise_identical() && shape_size(tmp->get_shape()) > 0)
+        if (m_binary_constant_data)
+        {
+            m_binary_constants.push_back(tmp);
+        }
+        else if (tmp->get_all_data_elements_bitwise_identical() &&
+                 shape_size(tmp->get_shape()) > 0)
         {
             vector<string> vs;
             vs.push_back(tmp->convert_value_to_string(0));
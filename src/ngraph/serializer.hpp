@@ -48,14 +48,37 @@ namespace ngraph
     ///    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
-    /// \brief Deserialize a Function
+    /// \brief Serialize a Function to a binary model file
+    ///
+    /// The data of every constant is stored as is, constants of a page or more on a page
+    /// boundary, followed by the graph as compact json. Deserializing the file maps the
+    /// constants instead of parsing or copying them.
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    void serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Serialize a Function to a binary model stream
+    /// \param out The output stream to which the data is serialized.
+    /// \param func The Function to serialize
+    void serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Deserialize a Function from a json, cpio or binary model stream
     /// \param in An isteam to the input data
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     /// \brief Deserialize a Function
-    /// \param str The json formatted string to deseriailze.
+    /// \param str The json formatted string to deseriailze, or the path of a json, cpio or binary
+    ///    model file.
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 
+    /// \brief Deserialize a Function from a binary model file
+    ///
+    /// The file is memory mapped and the constants of the Function use the mapped data, so
+    /// processes loading the same model share its pages. The mapping is released when the last
+    /// constant using it is destroyed.
+    /// \param path The path of a file written by serialize_binary
+    std::shared_ptr<ngraph::Function> deserialize_binary(const std::string& path);
+
     /// \brief If enabled adds output shapes to the serialized graph
     /// \param enable Set to true to enable or false otherwise
     ///
@@ -33,6 +33,16 @@ void ngraph::serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func
     throw std::runtime_error("serializer disabled in build");
 }
 
+void ngraph::serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+void ngraph::serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
 std::shared_ptr<ngraph::Function> ngraph::deserialize(std::istream& in)
 {
     throw std::runtime_error("serializer disabled in build");
@@ -43,6 +53,11 @@ std::shared_ptr<ngraph::Function> ngraph::deserialize(const std::string& str)
     throw std::runtime_error("serializer disabled in build");
 }
 
+std::shared_ptr<ngraph::Function> ngraph::deserialize_binary(const std::string& path)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
 void ngraph::set_serialize_output_shapes(bool enable)
 {
     throw std::runtime_error("serializer disabled in build");
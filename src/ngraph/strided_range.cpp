@@ -0,0 +1,147 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/strided_range.hpp"
+#include "ngraph/check.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+StridedRange::StridedRange(const Shape& shape,
+                           const vector<ptrdiff_t>& strides_a,
+                           const vector<ptrdiff_t>& strides_b,
+                           ptrdiff_t offset_a,
+                           ptrdiff_t offset_b)
+    : m_offset_a(offset_a)
+    , m_offset_b(offset_b)
+{
+    NGRAPH_CHECK(strides_a.size() == shape.size() && strides_b.size() == shape.size(),
+                 "Strides must have the rank of the shape ",
+                 shape);
+
+    // Drop unit axes and merge each axis into the previous one when it continues it in both
+    // tensors
+    for (size_t axis = 0; axis < shape.size(); axis++)
+    {
+        if (shape[axis] == 0)
+        {
+            m_empty = true;
+        }
+        if (shape[axis] == 1)
+        {
+            continue;
+        }
+        ptrdiff_t length = static_cast<ptrdiff_t>(shape[axis]);
+        if (!m_shape.empty() && m_strides_a.back() == strides_a[axis] * length &&
+            m_strides_b.back() == strides_b[axis] * length)
+        {
+            m_shape.back() *= shape[axis];
+            m_strides_a.back() = strides_a[axis];
+            m_strides_b.back() = strides_b[axis];
+        }
+        else
+        {
+            m_shape.push_back(shape[axis]);
+            m_strides_a.push_back(strides_a[axis]);
+            m_strides_b.push_back(strides_b[axis]);
+        }
+    }
+
+    if (!m_shape.empty())
+    {
+        m_run_length = m_shape.back();
+        m_run_stride_a = m_strides_a.back();
+        m_run_stride_b = m_strides_b.back();
+        m_shape.pop_back();
+        m_strides_a.pop_back();
+        m_strides_b.pop_back();
+    }
+    if (m_empty)
+    {
+        m_run_length = 0;
+    }
+}
+
+namespace
+{
+    // Strides of the output of reducing in_shape over reduction_axes, along the axes of in_shape
+    vector<ptrdiff_t> reduced_strides(const Shape& in_shape, const AxisSet& reduction_axes)
+    {
+        Shape out_shape;
+        for (size_t axis = 0; axis < in_shape.size(); axis++)
+        {
+            if (reduction_axes.count(axis) == 0)
+            {
+                out_shape.push_back(in_shape[axis]);
+            }
+        }
+        vector<ptrdiff_t> out_strides = StridedRange::strides(out_shape);
+
+        vector<ptrdiff_t> result;
+        size_t out_axis = 0;
+        for (size_t axis = 0; axis < in_shape.size(); axis++)
+        {
+            result.push_back(reduction_axes.count(axis) == 0 ? out_strides[out_axis++] : 0);
+        }
+        return result;
+    }
+}
+
+StridedRange StridedRange::reduction(const Shape& in_shape, const AxisSet& reduction_axes)
+{
+    return StridedRange(in_shape, strides(in_shape), reduced_strides(in_shape, reduction_axes));
+}
+
+StridedRange StridedRange::reduction(const Shape& in_shape,
+                                     const AxisSet& reduction_axes,
+                                     size_t begin,
+                                     size_t end)
+{
+    NGRAPH_CHECK(!in_shape.empty() && reduction_axes.count(0) == 0,
+                 "The first axis of a partial reduction must not be reduced");
+    NGRAPH_CHECK(begin <= end && end <= in_shape[0],
+                 "Range [",
+                 begin,
+                 ", ",
+                 end,
+                 ") is outside the first axis of ",
+                 in_shape);
+
+    vector<ptrdiff_t> strides_a = strides(in_shape);
+    vector<ptrdiff_t> strides_b = reduced_strides(in_shape, reduction_axes);
+    Shape part_shape = in_shape;
+    part_shape[0] = end - begin;
+    ptrdiff_t first = static_cast<ptrdiff_t>(begin);
+    return StridedRange(
+        part_shape, strides_a, strides_b, first * strides_a[0], first * strides_b[0]);
+}
+
+vector<ptrdiff_t> StridedRange::strides(const Shape& shape)
+{
+    vector<ptrdiff_t> result(shape.size());
+    ptrdiff_t stride = 1;
+    for (size_t i = shape.size(); i-- > 0;)
+    {
+        result[i] = stride;
+        stride *= static_cast<ptrdiff_t>(shape[i]);
+    }
+    return result;
+}
+
+size_t StridedRange::get_run_count() const
+{
+    return m_empty ? 0 : shape_size(m_shape);
+}
@@ -0,0 +1,126 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    /// \brief Visits every element of a shape in row major order, tracking the element offsets
+    ///        of two tensors addressed with arbitrary (possibly zero or negative) strides.
+    ///
+    /// Unlike CoordinateTransform nothing is allocated per element. Axes of length one are
+    /// dropped and adjacent axes that are contiguous in both tensors are merged, so the
+    /// innermost axis becomes a run that kernels process with a plain loop:
+    ///
+    ///     range.for_each([&](size_t a, size_t b) {
+    ///         for (size_t i = 0; i < range.get_run_length(); i++)
+    ///         {
+    ///             out[a + i * range.get_run_stride_a()] = arg[b + i * range.get_run_stride_b()];
+    ///         }
+    ///     });
+    class NGRAPH_API StridedRange
+    {
+    public:
+        /// \param shape Shape being visited
+        /// \param strides_a Element stride of the first tensor along each axis of shape
+        /// \param strides_b Element stride of the second tensor along each axis of shape
+        /// \param offset_a Offset of the first tensor at the origin of shape
+        /// \param offset_b Offset of the second tensor at the origin of shape
+        StridedRange(const Shape& shape,
+                     const std::vector<std::ptrdiff_t>& strides_a,
+                     const std::vector<std::ptrdiff_t>& strides_b,
+                     std::ptrdiff_t offset_a = 0,
+                     std::ptrdiff_t offset_b = 0);
+
+        /// \brief Visits a contiguous input of in_shape (a) and the output of reducing it over
+        ///        reduction_axes (b). Several elements of a map to each element of b.
+        static StridedRange reduction(const Shape& in_shape, const AxisSet& reduction_axes);
+
+        /// \brief As reduction(in_shape, reduction_axes), restricted to indices [begin, end) of
+        ///        the first axis of in_shape. The first axis must not be reduced, so ranges over
+        ///        disjoint index intervals write disjoint outputs.
+        static StridedRange reduction(const Shape& in_shape,
+                                      const AxisSet& reduction_axes,
+                                      size_t begin,
+                                      size_t end);
+
+        /// \brief Row major strides of shape, as signed values
+        static std::vector<std::ptrdiff_t> strides(const Shape& shape);
+
+        /// \brief Calls f(offset_a, offset_b) at the start of every run
+        template <typename F>
+        void for_each(F f) const
+        {
+            if (m_empty)
+            {
+                return;
+            }
+            size_t outer_rank = m_shape.size();
+            std::vector<size_t> counter(outer_rank, 0);
+            std::ptrdiff_t offset_a = m_offset_a;
+            std::ptrdiff_t offset_b = m_offset_b;
+            while (true)
+            {
+                f(static_cast<size_t>(offset_a), static_cast<size_t>(offset_b));
+                size_t axis = outer_rank;
+                while (true)
+                {
+                    if (axis == 0)
+                    {
+                        return;
+                    }
+                    --axis;
+                    offset_a += m_strides_a[axis];
+                    offset_b += m_strides_b[axis];
+                    if (++counter[axis] < m_shape[axis])
+                    {
+                        break;
+                    }
+                    counter[axis] = 0;
+                    offset_a -= m_strides_a[axis] * static_cast<std::ptrdiff_t>(m_shape[axis]);
+                    offset_b -= m_strides_b[axis] * static_cast<std::ptrdiff_t>(m_shape[axis]);
+                }
+            }
+        }
+
+        /// \brief Number of elements in each run
+        size_t get_run_length() const { return m_run_length; }
+        /// \brief Stride of the first tensor within a run
+        std::ptrdiff_t get_run_stride_a() const { return m_run_stride_a; }
+        /// \brief Stride of the second tensor within a run
+        std::ptrdiff_t get_run_stride_b() const { return m_run_stride_b; }
+        /// \brief Number of runs visited by for_each
+        size_t get_run_count() const;
+
+    private:
+        // Outer axes, excluding the run
+        Shape m_shape;
+        std::vector<std::ptrdiff_t> m_strides_a;
+        std::vector<std::ptrdiff_t> m_strides_b;
+        std::ptrdiff_t m_offset_a;
+        std::ptrdiff_t m_offset_b;
+        size_t m_run_length{1};
+        std::ptrdiff_t m_run_stride_a{0};
+        std::ptrdiff_t m_run_stride_b{0};
+        bool m_empty{false};
+    };
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstring>
 #include <deque>
 #include <forward_list>
 #include <iomanip>
@@ -162,6 +163,26 @@ size_t ngraph::hash_combine(const std::vector<size_t>& list)
     return seed;
 }
 
+size_t ngraph::hash_bytes(const void* data, size_t size)
+{
+    // FNV-1a over 8 byte words, then over the remaining bytes
+    const char* bytes = static_cast<const char*>(data);
+    const uint64_t prime = 1099511628211ULL;
+    uint64_t hash = 14695981039346656037ULL;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; ++i)
+    {
+        hash = (hash ^ static_cast<unsigned char>(bytes[i])) * prime;
+    }
+    return static_cast<size_t>(hash);
+}
+
 void* ngraph::ngraph_malloc(size_t size)
 {
     auto ptr = malloc(size);
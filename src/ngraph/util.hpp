@@ -76,6 +76,8 @@ namespace ngraph
     }
 
     size_t hash_combine(const std::vector<size_t>& list);
+    /// \brief Hashes the content of a block of memory
+    size_t hash_bytes(const void* data, size_t size);
     void dump(std::ostream& out, const void*, size_t);
 
     std::string to_lower(const std::string& s);
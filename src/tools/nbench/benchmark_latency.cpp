@@ -0,0 +1,292 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <thread>
+
+#include "benchmark_latency.hpp"
+#include "benchmark_utils.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using latency_clock = chrono::steady_clock;
+
+class LatencyClient
+{
+public:
+    vector<shared_ptr<runtime::HostTensor>> parameter_data;
+    vector<shared_ptr<runtime::HostTensor>> result_data;
+
+    vector<shared_ptr<runtime::Tensor>> input_tensors;
+    vector<shared_ptr<runtime::Tensor>> output_tensors;
+
+    /// Latency of each measured request in microseconds
+    vector<double> latencies;
+};
+
+static void call_once(runtime::Executable* exec, const LatencyClient& client, bool copy_data)
+{
+    const vector<shared_ptr<runtime::Tensor>>& args = client.input_tensors;
+    const vector<shared_ptr<runtime::Tensor>>& results = client.output_tensors;
+    if (copy_data)
+    {
+        for (size_t arg_index = 0; arg_index < args.size(); arg_index++)
+        {
+            const shared_ptr<runtime::Tensor>& arg = args[arg_index];
+            if (arg->get_stale())
+            {
+                const shared_ptr<runtime::HostTensor>& data = client.parameter_data[arg_index];
+                arg->write(data->get_data_ptr(),
+                           data->get_element_count() * data->get_element_type().size());
+            }
+        }
+    }
+    exec->call(results, args);
+    if (copy_data)
+    {
+        for (size_t result_index = 0; result_index < results.size(); result_index++)
+        {
+            const shared_ptr<runtime::HostTensor>& data = client.result_data[result_index];
+            const shared_ptr<runtime::Tensor>& result = results[result_index];
+            result->read(data->get_data_ptr(),
+                         data->get_element_count() * data->get_element_type().size());
+        }
+    }
+}
+
+static void client_entry(runtime::Executable* exec,
+                         LatencyClient* client,
+                         size_t iterations,
+                         bool copy_data,
+                         latency_clock::time_point first_arrival,
+                         latency_clock::duration interval)
+{
+    latency_clock::time_point next_arrival = first_arrival;
+    client->latencies.reserve(iterations);
+    for (size_t i = 0; i < iterations; i++)
+    {
+        latency_clock::time_point arrival;
+        if (interval == latency_clock::duration::zero())
+        {
+            arrival = latency_clock::now();
+        }
+        else
+        {
+            this_thread::sleep_until(next_arrival);
+            arrival = next_arrival;
+            next_arrival += interval;
+        }
+        call_once(exec, *client, copy_data);
+        client->latencies.push_back(
+            chrono::duration<double, micro>(latency_clock::now() - arrival).count());
+    }
+}
+
+/// Nearest rank percentile of sorted values
+static double percentile(const vector<double>& sorted, double p)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    size_t rank = static_cast<size_t>(ceil(p / 100 * sorted.size()));
+    return sorted[min(max<size_t>(rank, 1), sorted.size()) - 1];
+}
+
+vector<runtime::PerformanceCounter> run_benchmark_latency(shared_ptr<Function> f,
+                                                          const string& backend_name,
+                                                          size_t iterations,
+                                                          bool timing_detail,
+                                                          size_t warmup_iterations,
+                                                          bool copy_data,
+                                                          size_t concurrency,
+                                                          double request_rate,
+                                                          const string& json_file)
+{
+    NGRAPH_CHECK(concurrency > 0, "Latency benchmark needs at least one client");
+    stopwatch timer;
+    timer.start();
+    auto backend = runtime::Backend::create(backend_name);
+    auto exec = backend->compile(f, timing_detail);
+    timer.stop();
+    stringstream ss;
+    ss.imbue(locale(""));
+    ss << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+    set_denormals_flush_to_zero();
+
+    vector<LatencyClient> clients(concurrency);
+    for (LatencyClient& client : clients)
+    {
+        for (shared_ptr<op::Parameter> param : f->get_parameters())
+        {
+            auto tensor_data =
+                make_shared<runtime::HostTensor>(param->get_element_type(), param->get_shape());
+            random_init(tensor_data);
+            client.parameter_data.push_back(tensor_data);
+            client.input_tensors.push_back(
+                backend->create_tensor(param->get_element_type(), param->get_shape()));
+        }
+        for (shared_ptr<Node> result : f->get_results())
+        {
+            client.result_data.push_back(
+                make_shared<runtime::HostTensor>(result->get_element_type(), result->get_shape()));
+            client.output_tensors.push_back(
+                backend->create_tensor(result->get_element_type(), result->get_shape()));
+        }
+        // The first call always writes the inputs
+        for (size_t i = 0; i < warmup_iterations; i++)
+        {
+            call_once(exec.get(), client, true);
+        }
+        if (warmup_iterations == 0)
+        {
+            for (size_t arg_index = 0; arg_index < client.input_tensors.size(); arg_index++)
+            {
+                auto& data = client.parameter_data[arg_index];
+                client.input_tensors[arg_index]->write(
+                    data->get_data_ptr(),
+                    data->get_element_count() * data->get_element_type().size());
+            }
+        }
+    }
+
+    // Each client issues every concurrency-th request of the aggregate arrival schedule
+    latency_clock::duration interval = latency_clock::duration::zero();
+    latency_clock::duration stagger = latency_clock::duration::zero();
+    if (request_rate > 0)
+    {
+        stagger = chrono::duration_cast<latency_clock::duration>(
+            chrono::duration<double>(1.0 / request_rate));
+        interval = stagger * concurrency;
+    }
+
+    clock_t cpu_start = clock();
+    latency_clock::time_point start = latency_clock::now();
+    vector<thread> threads;
+    for (size_t i = 0; i < concurrency; i++)
+    {
+        threads.push_back(thread(client_entry,
+                                 exec.get(),
+                                 &clients[i],
+                                 iterations,
+                                 copy_data,
+                                 start + stagger * i,
+                                 interval));
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    double wall_seconds = chrono::duration<double>(latency_clock::now() - start).count();
+    double cpu_seconds = static_cast<double>(clock() - cpu_start) / CLOCKS_PER_SEC;
+
+    vector<double> latencies;
+    for (LatencyClient& client : clients)
+    {
+        latencies.insert(latencies.end(), client.latencies.begin(), client.latencies.end());
+    }
+    sort(latencies.begin(), latencies.end());
+    size_t request_count = latencies.size();
+    double mean = 0;
+    for (double latency : latencies)
+    {
+        mean += latency / request_count;
+    }
+    double throughput = request_count / wall_seconds;
+    double cores_used = cpu_seconds / wall_seconds;
+    size_t hardware_threads = max<size_t>(thread::hardware_concurrency(), 1);
+    vector<pair<string, double>> percentiles{{"p50", percentile(latencies, 50)},
+                                             {"p90", percentile(latencies, 90)},
+                                             {"p99", percentile(latencies, 99)},
+                                             {"p999", percentile(latencies, 99.9)},
+                                             {"max", percentile(latencies, 100)}};
+
+    ss << concurrency << " clients, ";
+    if (request_rate > 0)
+    {
+        ss << request_rate << " requests/s" << endl;
+    }
+    else
+    {
+        ss << "closed loop" << endl;
+    }
+    ss << request_count << " requests in " << wall_seconds * 1000 << "ms, " << throughput
+       << " requests/s" << endl;
+    ss << "latency mean " << mean / 1000 << "ms";
+    for (auto& p : percentiles)
+    {
+        ss << " " << p.first << " " << p.second / 1000 << "ms";
+    }
+    ss << endl;
+    ss << "cpu utilization " << cores_used << " cores, " << 100 * cores_used / hardware_threads
+       << "% of " << hardware_threads << " hardware threads" << endl;
+    cout << ss.str();
+
+    vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
+    if (!json_file.empty())
+    {
+        map<string, pair<size_t, size_t>> op_times;
+        for (const runtime::PerformanceCounter& p : perf_data)
+        {
+            auto& op_time = op_times[p.get_node()->description()];
+            op_time.first += p.total_microseconds();
+            op_time.second += p.call_count();
+        }
+
+        ofstream out(json_file);
+        out << "{\n";
+        out << "  \"backend\": \"" << backend_name << "\",\n";
+        out << "  \"clients\": " << concurrency << ",\n";
+        out << "  \"request_rate\": " << request_rate << ",\n";
+        out << "  \"requests\": " << request_count << ",\n";
+        out << "  \"duration_ms\": " << wall_seconds * 1000 << ",\n";
+        out << "  \"throughput\": " << throughput << ",\n";
+        out << "  \"latency_us\": {\"mean\": " << mean;
+        for (auto& p : percentiles)
+        {
+            out << ", \"" << p.first << "\": " << p.second;
+        }
+        out << "},\n";
+        out << "  \"cpu_cores_used\": " << cores_used << ",\n";
+        out << "  \"cpu_utilization\": " << cores_used / hardware_threads << ",\n";
+        out << "  \"ops\": [";
+        size_t count = 0;
+        for (auto& op_time : op_times)
+        {
+            out << (count++ > 0 ? ",\n    " : "\n    ") << "{\"op\": \"" << op_time.first
+                << "\", \"total_us\": " << op_time.second.first
+                << ", \"calls\": " << op_time.second.second << "}";
+        }
+        out << (count > 0 ? "\n  ]\n" : "]\n");
+        out << "}\n";
+        if (!out)
+        {
+            throw runtime_error("Could not write " + json_file);
+        }
+    }
+    return perf_data;
+}
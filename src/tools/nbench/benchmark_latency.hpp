@@ -0,0 +1,43 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+/// \brief Measures the latency distribution of concurrent clients sharing one executable.
+///
+/// Each of concurrency clients, at least one, has its own tensors and issues iterations
+/// requests. With a request_rate of 0 a client issues its next request as soon as the previous
+/// one completes (closed loop). Otherwise requests arrive at request_rate per second over all
+/// clients and latency is measured from the scheduled arrival time, so time spent queued behind
+/// late requests is included. Prints latency percentiles, throughput and CPU utilization and, if
+/// json_file is not empty, writes them with the per-op breakdown as JSON.
+std::vector<ngraph::runtime::PerformanceCounter>
+    run_benchmark_latency(std::shared_ptr<ngraph::Function> f,
+                          const std::string& backend_name,
+                          size_t iterations,
+                          bool timing_detail,
+                          size_t warmup_iterations,
+                          bool copy_data,
+                          size_t concurrency,
+                          double request_rate,
+                          const std::string& json_file);
@@ -27,8 +27,10 @@
 
 #include <fstream>
 #include <iomanip>
+#include <stdexcept>
 
 #include "benchmark.hpp"
+#include "benchmark_latency.hpp"
 #include "benchmark_pipelined.hpp"
 #include "ngraph/component_manager.hpp"
 #include "ngraph/distributed.hpp"
@@ -186,6 +188,10 @@ int main(int argc, char** argv)
     bool copy_data = true;
     bool dot_file = false;
     bool double_buffer = false;
+    bool latency = false;
+    size_t concurrency = 1;
+    double request_rate = 0;
+    string json_file;
 
     configure_static_backends();
     for (int i = 1; i < argc; i++)
@@ -239,6 +245,47 @@ int main(int argc, char** argv)
         {
             double_buffer = true;
         }
+        else if (arg == "--latency")
+        {
+            latency = true;
+        }
+        else if (arg == "-c" || arg == "--concurrency")
+        {
+            try
+            {
+                int value = stoi(argv[++i]);
+                if (value < 1)
+                {
+                    throw invalid_argument("concurrency must be at least 1");
+                }
+                concurrency = value;
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--rate")
+        {
+            try
+            {
+                request_rate = stod(argv[++i]);
+                if (!(request_rate >= 0))
+                {
+                    throw invalid_argument("rate must not be negative");
+                }
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--json")
+        {
+            json_file = argv[++i];
+        }
         else if (arg == "-w" || arg == "--warmup_iterations")
         {
             try
@@ -294,6 +341,11 @@ OPTIONS
         --no_copy_data            Disable copy of input/result data every iteration
         --dot                     Generate Graphviz dot file
         --double_buffer           Double buffer inputs and outputs
+        --latency                 Measure the latency distribution of concurrent clients
+        -c|--concurrency          Number of clients in latency mode (default: 1)
+        --rate                    Requests per second over all clients in latency mode
+                                  (default: 0, each client waits for its previous request)
+        --json                    Write latency mode results to this JSON file
 )###";
         return 1;
     }
@@ -439,7 +491,19 @@ OPTIONS
                 ss << t1.get_milliseconds();
                 cout << "deserialize took " << ss.str() << "ms\n";
                 vector<runtime::PerformanceCounter> perf_data;
-                if (double_buffer)
+                if (latency)
+                {
+                    perf_data = run_benchmark_latency(f,
+                                                      backend,
+                                                      iterations,
+                                                      timing_detail,
+                                                      warmup_iterations,
+                                                      copy_data,
+                                                      concurrency,
+                                                      request_rate,
+                                                      json_file);
+                }
+                else if (double_buffer)
                 {
                     perf_data = run_benchmark_pipelined(
                         f, backend, iterations, timing_detail, warmup_iterations, copy_data);
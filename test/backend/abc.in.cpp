@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cmath>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close_f.hpp"
@@ -60,6 +62,40 @@ NGRAPH_TEST(${BACKEND_NAME}, abc)
                                   (test::NDArray<float, 2>({{50, 72}, {98, 128}})).get_vector()));
 }
 
+// Intermediates whose last use is an elementwise op may share memory with its output
+NGRAPH_TEST(${BACKEND_NAME}, abc_reused_intermediates)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto T = (A + B) * (A - B);
+    auto f = make_shared<Function>(make_shared<op::Exp>(T) + T, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+
+    vector<float> av{1, 2, 3, 4};
+    vector<float> bv{0.5, 1, 1.5, 2};
+    copy_data(a, av);
+    copy_data(b, bv);
+
+    vector<float> expected;
+    for (size_t i = 0; i < av.size(); i++)
+    {
+        float t = (av[i] + bv[i]) * (av[i] - bv[i]);
+        expected.push_back(exp(t) + t);
+    }
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    EXPECT_EQ(av, read_vector<float>(a));
+    EXPECT_EQ(bv, read_vector<float>(b));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, abc_int64)
 {
     Shape shape{2, 2};
@@ -110,3 +110,33 @@ NGRAPH_TEST(${BACKEND_NAME}, get_parameters_and_results)
     //     EXPECT_NE(results[i], func_results[i]);
     // }
 }
+
+// A compiled function must not hold on to the tensors of a previous call
+NGRAPH_TEST(${BACKEND_NAME}, call_with_different_tensors)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(NodeVector{(A + B) * C, A}, ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    for (float i = 0; i < 3; i++)
+    {
+        shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+        shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+        shared_ptr<runtime::Tensor> c = backend->create_tensor(element::f32, shape);
+        shared_ptr<runtime::Tensor> r0 = backend->create_tensor(element::f32, shape);
+        shared_ptr<runtime::Tensor> r1 = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{i, 2, 3, 4});
+        copy_data(b, vector<float>{5, 6, 7, 8});
+        copy_data(c, vector<float>{2, 2, 2, i});
+
+        handle->call_with_validate({r0, r1}, {a, b, c});
+        EXPECT_TRUE(test::all_close_f(
+            (vector<float>{(i + 5) * 2, 16, 20, 12 * i}), read_vector<float>(r0)));
+        EXPECT_TRUE(test::all_close_f((vector<float>{i, 2, 3, 4}), read_vector<float>(r1)));
+    }
+}
@@ -0,0 +1,174 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <future>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, async_execute)
+{
+    Shape shape{100000};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto r = backend->create_tensor(element::f32, shape);
+
+    vector<float> data(shape_size(shape), 2);
+    vector<float> result_data(shape_size(shape), 0);
+
+    // The writes, the execution and the read are ordered through the tensors
+    future<void> write_a = a->begin_write(data.data(), data.size() * sizeof(float));
+    future<void> write_b = b->begin_write(data.data(), data.size() * sizeof(float));
+    future<bool> execute = handle->begin_execute({r}, {a, b});
+    future<void> read_r = r->begin_read(result_data.data(), data.size() * sizeof(float));
+
+    write_a.get();
+    write_b.get();
+    EXPECT_TRUE(execute.get());
+    read_r.get();
+
+    for (float x : result_data)
+    {
+        ASSERT_EQ(x, 4);
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, async_pipeline)
+{
+    Shape shape{1000};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Multiply>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    // Double buffered inputs and outputs so consecutive requests overlap
+    const size_t depth = 2;
+    const size_t requests = 8;
+    const size_t size = shape_size(shape) * sizeof(float);
+    vector<shared_ptr<runtime::Tensor>> a;
+    vector<shared_ptr<runtime::Tensor>> b;
+    vector<shared_ptr<runtime::Tensor>> r;
+    for (size_t i = 0; i < depth; i++)
+    {
+        a.push_back(backend->create_tensor(element::f32, shape));
+        b.push_back(backend->create_tensor(element::f32, shape));
+        r.push_back(backend->create_tensor(element::f32, shape));
+    }
+
+    vector<vector<float>> a_data(requests);
+    vector<float> b_data(shape_size(shape), 3);
+    vector<vector<float>> r_data(requests, vector<float>(shape_size(shape)));
+    vector<future<void>> writes;
+    vector<future<bool>> executions;
+    vector<future<void>> reads;
+    for (size_t i = 0; i < requests; i++)
+    {
+        size_t stage = i % depth;
+        a_data[i] = vector<float>(shape_size(shape), static_cast<float>(i));
+        writes.push_back(a[stage]->begin_write(a_data[i].data(), size));
+        writes.push_back(b[stage]->begin_write(b_data.data(), size));
+        executions.push_back(handle->begin_execute({r[stage]}, {a[stage], b[stage]}));
+        reads.push_back(r[stage]->begin_read(r_data[i].data(), size));
+    }
+    for (auto& write : writes)
+    {
+        write.get();
+    }
+    for (auto& execution : executions)
+    {
+        EXPECT_TRUE(execution.get());
+    }
+    for (auto& read : reads)
+    {
+        read.get();
+    }
+
+    for (size_t i = 0; i < requests; i++)
+    {
+        for (float x : r_data[i])
+        {
+            ASSERT_EQ(x, 3 * i);
+        }
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, async_concurrent_writers)
+{
+    Shape shape{1000};
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto t = backend->create_tensor(element::f32, shape);
+    const size_t size = shape_size(shape) * sizeof(float);
+
+    // Threads race to queue writes and reads on the same tensor; every read must see one
+    // complete write
+    const size_t thread_count = 4;
+    const size_t iterations = 50;
+    vector<vector<float>> values(thread_count);
+    vector<vector<vector<float>>> results(thread_count);
+    vector<thread> threads;
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        values[i] = vector<float>(shape_size(shape), static_cast<float>(i + 1));
+        results[i] = vector<vector<float>>(iterations, vector<float>(shape_size(shape)));
+        threads.emplace_back([&, i]() {
+            vector<future<void>> pending;
+            for (size_t j = 0; j < iterations; j++)
+            {
+                pending.push_back(t->begin_write(values[i].data(), size));
+                pending.push_back(t->begin_read(results[i][j].data(), size));
+            }
+            for (auto& f : pending)
+            {
+                f.get();
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+
+    for (auto& thread_results : results)
+    {
+        for (auto& result : thread_results)
+        {
+            for (float x : result)
+            {
+                ASSERT_EQ(x, result[0]);
+            }
+            ASSERT_GE(result[0], 1);
+            ASSERT_LE(result[0], thread_count);
+        }
+    }
+}
@@ -137,6 +137,95 @@ NGRAPH_TEST(${BACKEND_NAME}, convolution_simple_padding)
     EXPECT_TRUE(test::all_close_f(vector<float>{expected_result}, read_vector<float>(result)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, convolution_1x1_multi_channel)
+{
+    Shape shape_a{1, 2, 2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{2, 2, 1, 1};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    Shape shape_r{1, 2, 2, 2};
+    auto conv1 = make_shared<op::Convolution>(A, B);
+
+    auto f = make_shared<Function>(conv1, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{1.0f, 1.0f, 1.0f, -1.0f});
+    auto result = backend->create_tensor(element::f32, shape_r);
+    vector<float> expected_result{6.0f, 8.0f, 10.0f, 12.0f, -4.0f, -4.0f, -4.0f, -4.0f};
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(vector<float>{expected_result}, read_vector<float>(result)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convolution_1d_strided_padding)
+{
+    Shape shape_a{1, 1, 5};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{1, 1, 2};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    Shape shape_r{1, 1, 3};
+    auto conv1 = make_shared<op::Convolution>(A,
+                                              B,
+                                              Strides{2},
+                                              Strides{1},
+                                              CoordinateDiff{1},
+                                              CoordinateDiff{1},
+                                              Strides{1});
+
+    auto f = make_shared<Function>(conv1, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{2.0f, 1.0f});
+    auto result = backend->create_tensor(element::f32, shape_r);
+    vector<float> expected_result{1.0f, 7.0f, 13.0f};
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(vector<float>{expected_result}, read_vector<float>(result)));
+}
+
+// Padded taps contribute nothing, even when the filter value they meet is infinite
+NGRAPH_TEST(${BACKEND_NAME}, convolution_1d_padding_infinite_filter)
+{
+    Shape shape_a{1, 1, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{1, 1, 3};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    Shape shape_r{1, 1, 2};
+    auto conv1 = make_shared<op::Convolution>(A,
+                                              B,
+                                              Strides{1},
+                                              Strides{1},
+                                              CoordinateDiff{1},
+                                              CoordinateDiff{0},
+                                              Strides{1});
+
+    auto f = make_shared<Function>(conv1, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1.0f, 2.0f, 3.0f});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{numeric_limits<float>::infinity(), 1.0f, 1.0f});
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    vector<float> r = read_vector<float>(result);
+    EXPECT_EQ(r[0], 3.0f);
+    EXPECT_TRUE(isinf(r[1]));
+}
+
 // The purpose of this test is to check if we can allow
 // data_batch_shape as a node rather than argument
 NGRAPH_TEST(${BACKEND_NAME}, dyn_convolution_backprop_data)
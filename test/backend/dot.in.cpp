@@ -685,6 +685,104 @@ NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_vector_int64)
     EXPECT_EQ((vector<int64_t>{190, 486, 782, 1078}), read_vector<int64_t>(result));
 }
 
+// Large enough to cross the row, column and depth blocks of the reference kernel
+NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_blocked_int32)
+{
+    const size_t m = 7;
+    const size_t k = 300;
+    const size_t n = 261;
+    Shape shape_a{m, k};
+    Shape shape_b{k, n};
+    auto A = make_shared<op::Parameter>(element::i32, shape_a);
+    auto B = make_shared<op::Parameter>(element::i32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), ParameterVector{A, B});
+    Shape shape_r{m, n};
+
+    vector<int32_t> a_data(m * k);
+    vector<int32_t> b_data(k * n);
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<int32_t>(i % 13) - 6;
+    }
+    for (size_t i = 0; i < b_data.size(); i++)
+    {
+        b_data[i] = static_cast<int32_t>(i % 7) - 3;
+    }
+    vector<int32_t> expected(m * n, 0);
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            for (size_t p = 0; p < k; p++)
+            {
+                expected[i * n + j] += a_data[i * k + p] * b_data[p * n + j];
+            }
+        }
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i32, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::i32, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::i32, shape_r);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(expected, read_vector<int32_t>(result));
+}
+
+// Crosses several 32 row panels with a partial last panel and a partial 4 row tile, as well as
+// the column and depth blocks
+NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_blocked_panels_f32)
+{
+    const size_t m = 70;
+    const size_t k = 150;
+    const size_t n = 261;
+    Shape shape_a{m, k};
+    Shape shape_b{k, n};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), ParameterVector{A, B});
+    Shape shape_r{m, n};
+
+    // Small integers keep every partial sum exact whatever order it is accumulated in
+    vector<float> a_data(m * k);
+    vector<float> b_data(k * n);
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>(i % 11) - 5;
+    }
+    for (size_t i = 0; i < b_data.size(); i++)
+    {
+        b_data[i] = static_cast<float>(i % 5) - 2;
+    }
+    vector<float> expected(m * n, 0);
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            for (size_t p = 0; p < k; p++)
+            {
+                expected[i * n + j] += a_data[i * k + p] * b_data[p * n + j];
+            }
+        }
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(expected, read_vector<float>(result));
+}
+
 //
 // Numpy test:
 //
@@ -15,7 +15,9 @@
 //*****************************************************************************
 
 #include "gtest/gtest.h"
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
@@ -292,3 +294,145 @@ NGRAPH_TEST(${BACKEND_NAME}, dynamic_reverse_shape)
                         Shape{8, 2, 8, 2},
                         Shape{2, 3, 4, 5, 2}});
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_shape_buckets)
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto b = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto f = make_shared<Function>(NodeVector{a * b}, ParameterVector{a, b});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    string error;
+    ASSERT_TRUE(backend->set_config({{"shape_buckets", "4,8"}}, error)) << error;
+    auto ex = backend->compile(f);
+    auto dynamic_ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex);
+    ASSERT_NE(dynamic_ex, nullptr);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape::dynamic(2));
+
+    for (size_t rows : {1, 3, 4, 2, 6, 8})
+    {
+        vector<float> a_data(rows * 2);
+        vector<float> b_data(rows * 2);
+        vector<float> expected(rows * 2);
+        for (size_t i = 0; i < rows * 2; i++)
+        {
+            a_data[i] = i;
+            b_data[i] = i + 1;
+            expected[i] = a_data[i] * b_data[i];
+        }
+        auto t_a = backend->create_tensor(element::f32, Shape{rows, 2});
+        auto t_b = backend->create_tensor(element::f32, Shape{rows, 2});
+        copy_data(t_a, a_data);
+        copy_data(t_b, b_data);
+
+        ex->call_with_validate({t_r}, {t_a, t_b});
+
+        ASSERT_EQ(t_r->get_shape(), (Shape{rows, 2}));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), expected));
+    }
+
+    // Six calls, but only the buckets 4 and 8 were compiled
+    auto stats = dynamic_ex->get_cache()->get_statistics();
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.hits, 4);
+    EXPECT_EQ(stats.entries, 2);
+
+    // Larger than every bucket, so compiled for its own shape
+    auto t_a = backend->create_tensor(element::f32, Shape{9, 2});
+    auto t_b = backend->create_tensor(element::f32, Shape{9, 2});
+    copy_data(t_a, vector<float>(18, 2));
+    copy_data(t_b, vector<float>(18, 3));
+    ex->call_with_validate({t_r}, {t_a, t_b});
+    ASSERT_EQ(t_r->get_shape(), (Shape{9, 2}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), vector<float>(18, 6)));
+    EXPECT_EQ(dynamic_ex->get_cache()->get_statistics().misses, 3);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_cache_eviction)
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape::dynamic(1));
+    auto f = make_shared<Function>(NodeVector{a + a}, ParameterVector{a});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    string error;
+    EXPECT_FALSE(backend->set_config({{"cache_max_entries", "-1"}}, error));
+    EXPECT_FALSE(backend->set_config({{"cache_max_bytes", "-1"}}, error));
+    ASSERT_TRUE(backend->set_config({{"cache_max_entries", "2"}}, error)) << error;
+    auto ex = backend->compile(f);
+    auto cache = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex)->get_cache();
+    EXPECT_EQ(cache->get_max_entries(), 2);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape::dynamic(1));
+    for (size_t size : {1, 2, 3, 1})
+    {
+        auto t_a = backend->create_tensor(element::f32, Shape{size});
+        copy_data(t_a, vector<float>(size, 1));
+        ex->call_with_validate({t_r}, {t_a});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), vector<float>(size, 2)));
+    }
+
+    auto stats = cache->get_statistics();
+    EXPECT_EQ(stats.entries, 2);
+    EXPECT_EQ(stats.evictions, 2);
+    EXPECT_EQ(stats.misses, 4);
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_GT(stats.bytes, 0);
+}
+
+#ifndef NGRAPH_JSON_DISABLE
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_cache_persisted)
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape::dynamic(1));
+    auto f = make_shared<Function>(NodeVector{a * a}, ParameterVector{a});
+
+    string cache_dir = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_dynamic_cache_persisted");
+    file_util::remove_directory(cache_dir);
+
+    auto run = [&](size_t& misses, size_t& loads, size_t& bytes) {
+        auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+        string error;
+        ASSERT_TRUE(backend->set_config({{"cache_dir", cache_dir}}, error)) << error;
+        auto ex = backend->compile(f);
+        auto t_a = backend->create_tensor(element::f32, Shape{3});
+        auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape::dynamic(1));
+        copy_data(t_a, vector<float>{1, 2, 3});
+        ex->call_with_validate({t_r}, {t_a});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), vector<float>{1, 4, 9}));
+        auto dynamic_ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex);
+        misses = dynamic_ex->get_cache()->get_statistics().misses;
+        loads = dynamic_ex->get_persisted_loads();
+        bytes = dynamic_ex->get_cache()->get_statistics().bytes;
+    };
+
+    size_t misses = 0;
+    size_t loads = 0;
+    size_t compiled_bytes = 0;
+    run(misses, loads, compiled_bytes);
+    EXPECT_EQ(misses, 1);
+    EXPECT_EQ(loads, 0);
+
+    size_t persisted = 0;
+    file_util::iterate_files(cache_dir,
+                             [&](const string& file, bool is_dir) {
+                                 if (!is_dir && file.substr(file.size() - 5) == ".exec")
+                                 {
+                                     persisted++;
+                                 }
+                             },
+                             false);
+    EXPECT_EQ(persisted, 1);
+
+    // A fresh executable misses in memory and loads the specialization from disk, which is
+    // charged the size estimated when it was compiled
+    size_t loaded_bytes = 0;
+    run(misses, loads, loaded_bytes);
+    EXPECT_EQ(misses, 1);
+    EXPECT_EQ(loads, 1);
+    EXPECT_GT(compiled_bytes, 0);
+    EXPECT_EQ(loaded_bytes, compiled_bytes);
+
+    file_util::remove_directory(cache_dir);
+}
+#endif
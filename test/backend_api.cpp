@@ -59,6 +59,31 @@ TEST(backend_api, config_unsupported)
     EXPECT_FALSE(error == "");
 }
 
+TEST(backend_api, config_intra_op_parallelism)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    string error;
+    EXPECT_FALSE(backend->set_config({{"intra_op_parallelism", "0"}}, error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_FALSE(backend->set_config({{"intra_op_parallelism", "many"}}, error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_TRUE(backend->set_config({{"intra_op_parallelism", "3"}}, error));
+    EXPECT_STREQ(error.c_str(), "");
+
+    // Large enough to be split across the threads
+    Shape shape{256, 1024};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(
+        make_shared<op::Sum>(make_shared<op::Exp>(A), AxisSet{1}), ParameterVector{A});
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, Shape{256});
+    copy_data(a, vector<float>(shape_size(shape), 0.f));
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>(256, 1024.f)));
+}
+
 #ifndef NGRAPH_JSON_DISABLE
 TEST(backend_api, save_load)
 {
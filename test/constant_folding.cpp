@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <numeric>
+
 #include "ngraph/pass/constant_folding.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/subgraph_constant_folding.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
@@ -496,6 +499,91 @@ TEST(constant_folding, const_quantize)
     ASSERT_EQ(values_quantize, values_out);
 }
 
+TEST(constant_folding, const_quantize_per_axis)
+{
+    Shape input_shape{2, 3, 4};
+    Shape scale_offset_shape{2, 4};
+    AxisSet quantization_axes{0, 2};
+
+    vector<float> values_in(shape_size(input_shape));
+    vector<float> scales{1, 2, 4, 8, 2, 4, 8, 16};
+    vector<int8_t> offsets{0, 1, 2, 3, -1, -2, -3, -4};
+    for (size_t i = 0; i < values_in.size(); ++i)
+    {
+        values_in[i] = static_cast<float>(i) * 3 - 30;
+    }
+    auto constant = op::Constant::create(element::f32, input_shape, values_in);
+    auto scale = op::Constant::create(element::f32, scale_offset_shape, scales);
+    auto offset = op::Constant::create(element::i8, scale_offset_shape, offsets);
+    auto mode = op::Quantize::RoundMode::ROUND_DOWN;
+    auto quantize =
+        make_shared<op::Quantize>(constant, scale, offset, element::i8, quantization_axes, mode);
+    auto dequantize =
+        make_shared<op::Dequantize>(quantize, scale, offset, element::f32, quantization_axes);
+    auto f = make_shared<Function>(NodeVector{quantize, dequantize}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Quantize>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Dequantize>(f), 0);
+
+    auto quantized = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(quantized);
+    auto dequantized = as_type_ptr<op::Constant>(f->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(dequantized);
+    auto quantized_values = quantized->get_vector<int8_t>();
+    auto dequantized_values = dequantized->get_vector<float>();
+    for (size_t i = 0; i < values_in.size(); ++i)
+    {
+        size_t j = (i / 12) * 4 + i % 4;
+        int8_t expected = static_cast<int8_t>(floor(values_in[i] / scales[j]) + offsets[j]);
+        EXPECT_EQ(expected, quantized_values[i]) << i;
+        EXPECT_EQ((expected - offsets[j]) * scales[j], dequantized_values[i]) << i;
+    }
+}
+
+TEST(constant_folding, const_transpose_large)
+{
+    // Large enough to take the parallel row by row path
+    Shape shape{40, 64, 32};
+    vector<int32_t> values_in(shape_size(shape));
+    iota(values_in.begin(), values_in.end(), 0);
+    auto constant = op::Constant::create(element::i32, shape, values_in);
+    auto perm = op::Constant::create(element::i64, Shape{3}, {2, 0, 1});
+    auto transpose = make_shared<op::Transpose>(constant, perm);
+    auto reshape = make_shared<op::Reshape>(constant, AxisVector{0, 1, 2}, Shape{2560, 32});
+    auto f = make_shared<Function>(NodeVector{transpose, reshape}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Transpose>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 0);
+
+    auto transposed = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(transposed);
+    ASSERT_EQ(transposed->get_shape(), (Shape{32, 40, 64}));
+    auto values_out = transposed->get_vector<int32_t>();
+    size_t index = 0;
+    for (size_t k = 0; k < 32; ++k)
+    {
+        for (size_t i = 0; i < 40; ++i)
+        {
+            for (size_t j = 0; j < 64; ++j)
+            {
+                ASSERT_EQ(values_in[(i * 64 + j) * 32 + k], values_out[index++]);
+            }
+        }
+    }
+
+    auto reshaped = as_type_ptr<op::Constant>(f->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(reshaped);
+    ASSERT_EQ(values_in, reshaped->get_vector<int32_t>());
+}
+
 TEST(constant_folding, const_convert)
 {
     Shape input_shape{3, 4};
@@ -2341,3 +2429,67 @@ TEST(constant_folding, pass_property)
     ASSERT_FALSE(pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
     ASSERT_TRUE(pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+TEST(constant_folding, subgraph)
+{
+    // Dot has no hand-written folder
+    auto A = op::Constant::create(element::f32, Shape{2, 2}, {1, -2, 3, -4});
+    auto B = op::Constant::create(element::f32, Shape{2, 2}, {1, 0, 0, 1});
+    auto relu = make_shared<op::Relu>(make_shared<op::Dot>(A, B));
+    auto C = op::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto D = op::Constant::create(element::f32, Shape{2}, {3, 4});
+    auto dot = make_shared<op::Dot>(C, D);
+    auto P = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto add = make_shared<op::Add>(P, relu);
+    auto f = make_shared<Function>(NodeVector{add, dot}, ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::SubgraphConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Relu>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 2);
+
+    auto folded_relu = as_type_ptr<op::Constant>(add->get_argument(1));
+    ASSERT_TRUE(folded_relu);
+    EXPECT_EQ(folded_relu->get_shape(), (Shape{2, 2}));
+    EXPECT_EQ(folded_relu->get_vector<float>(), (vector<float>{1, 0, 3, 0}));
+    auto folded_dot = as_type_ptr<op::Constant>(f->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(folded_dot);
+    EXPECT_EQ(folded_dot->get_vector<float>(), (vector<float>{11}));
+}
+
+TEST(constant_folding, subgraph_size_cap)
+{
+    auto A = op::Constant::create(element::f32, Shape{}, {2});
+    auto broadcast = make_shared<op::Broadcast>(A, Shape{100, 100}, AxisSet{0, 1});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{100, 100});
+    auto f = make_shared<Function>(make_shared<op::Multiply>(P, broadcast), ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::SubgraphConstantFolding>("INTERPRETER", 1024);
+    pass_manager.run_passes(f);
+
+    // folding would grow the model from 4 bytes to 40000
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+}
+
+TEST(constant_folding, subgraph_keeps_random_ops)
+{
+    auto A = op::Constant::create(element::f32, Shape{4}, {1, 2, 3, 4});
+    auto negative = make_shared<op::Negative>(A);
+    auto generate_mask = make_shared<op::GenerateMask>(
+        op::Constant::create(element::boolean, Shape{}, {1}), Shape{4}, element::f32, 5, 0.5, true);
+    auto f = make_shared<Function>(make_shared<op::Multiply>(negative, generate_mask),
+                                   ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::SubgraphConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::GenerateMask>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(f), 1);
+}
@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(constant_folding, DISABLED_benchmark_large_weights)
+{
+    // A 64MB weight which is transposed, quantized and converted as when loading a model
+    Shape shape{1024, 4096, 4};
+    vector<float> values_in(shape_size(shape));
+    for (size_t i = 0; i < values_in.size(); ++i)
+    {
+        values_in[i] = static_cast<float>(i % 251) - 125;
+    }
+    auto constant = op::Constant::create(element::f32, shape, values_in);
+    auto perm = op::Constant::create(element::i64, Shape{3}, {1, 0, 2});
+    auto transpose = make_shared<op::Transpose>(constant, perm);
+    auto scale = op::Constant::create(element::f32, Shape{}, {0.5});
+    auto offset = op::Constant::create(element::i8, Shape{}, {0});
+    auto quantize = make_shared<op::Quantize>(transpose,
+                                              scale,
+                                              offset,
+                                              element::i8,
+                                              AxisSet{},
+                                              op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+    auto convert = make_shared<op::Convert>(quantize, element::i32);
+    auto f = make_shared<Function>(convert, ParameterVector{});
+
+    stopwatch timer;
+    timer.start();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+    timer.stop();
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+    std::cout << "Folded in " << timer.get_milliseconds() << " ms" << std::endl;
+}
@@ -913,3 +913,32 @@ TEST(core_fusion, MLIR_DISABLE_TEST(crossentropy))
     test_crossentropy(Shape{10, 2, 4, 10}, Shape{10, 2, 4, 1}, false, 5);
     test_crossentropy(Shape{4, 3, 2, 4}, Shape{4, 3, 2, 4}, true, -1);
 }
+
+TEST(core_fusion, DISABLED_benchmark_core_fusion)
+{
+    Shape shape{2, 3};
+    auto param = make_shared<op::Parameter>(element::f32, shape);
+    auto zero = op::Constant::create(element::f32, shape, vector<float>{0, 0, 0, 0, 0, 0});
+    shared_ptr<Node> n = param;
+    for (size_t i = 0; i < 10000; i++)
+    {
+        // Only every tenth block can be fused into a Relu
+        n = make_shared<op::Abs>(make_shared<op::Multiply>(n, param) + param);
+        if (i % 10 == 0)
+        {
+            n = make_shared<op::Maximum>(n, zero);
+        }
+    }
+    auto f = make_shared<Function>(n, ParameterVector{param});
+
+    stopwatch timer;
+    timer.start();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(f);
+    timer.stop();
+
+    EXPECT_EQ(count_ops_of_type<op::Relu>(f), 1000);
+    std::cout << "CoreFusion on " << f->get_ops().size() << " ops: " << timer.get_milliseconds()
+              << "ms" << std::endl;
+}
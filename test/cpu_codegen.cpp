@@ -14,7 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <sstream>
+
 #include "gtest/gtest.h"
+#include "misc.hpp"
+#include "ngraph/codegen/code_cache.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
@@ -60,3 +66,91 @@ TEST(cpu_codegen, abc)
                                   (test::NDArray<float, 2>({{50, 72}, {98, 128}})).get_vector(),
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
+
+TEST(cpu_codegen, cache)
+{
+    string directory =
+        file_util::path_join(file_util::get_temp_directory_path(), "cpu_codegen_cache_test");
+    file_util::remove_directory(directory);
+    set_environment("NGRAPH_CODEGEN_CACHE_DIR", directory.c_str(), 1);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>(A * B, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{5, 6, 7, 8});
+
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CODEGEN", true);
+    auto loads = codegen::CodeCache::get_module_loads();
+    auto handle = backend->compile(f, pass_config);
+    EXPECT_EQ(codegen::CodeCache::get_module_loads(), loads);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), vector<float>{5, 12, 21, 32}, MIN_FLOAT_TOLERANCE_BITS));
+
+    // A backend does not share compiled functions with others, so this compiles the same code
+    // again and finds it in the cache
+    auto cached_backend = runtime::Backend::create("CPU");
+    auto cached_handle = cached_backend->compile(f, pass_config);
+    unset_environment("NGRAPH_CODEGEN_CACHE_DIR");
+    EXPECT_EQ(codegen::CodeCache::get_module_loads(), loads + 1);
+    cached_handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), vector<float>{5, 12, 21, 32}, MIN_FLOAT_TOLERANCE_BITS));
+
+    // The bitcode and the object code of the function
+    vector<string> entries;
+    file_util::iterate_files(directory,
+                             [&](const string& file, bool is_dir) {
+                                 if (!is_dir)
+                                 {
+                                     entries.push_back(file_util::get_file_ext(file));
+                                 }
+                             });
+    sort(entries.begin(), entries.end());
+    EXPECT_EQ(entries, (vector<string>{".bc", ".o"}));
+    file_util::remove_directory(directory);
+}
+
+TEST(cpu_codegen, save_load)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>((A + B) * C, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CODEGEN", true);
+    auto handle = backend->compile(f, pass_config);
+
+    stringstream file;
+    handle->save(file);
+    auto loaded = backend->load(file);
+    ASSERT_NE(loaded, nullptr);
+    ASSERT_EQ(loaded->get_parameters().size(), 2);
+    EXPECT_EQ(loaded->get_parameters()[1]->get_shape(), shape);
+    ASSERT_EQ(loaded->get_results().size(), 1);
+    EXPECT_EQ(loaded->get_results()[0]->get_element_type(), element::f32);
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    loaded->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), vector<float>{6, 16, 30, 48}, MIN_FLOAT_TOLERANCE_BITS));
+
+    // Inputs may change between calls
+    copy_data(a, vector<float>{0, 0, 0, 0});
+    loaded->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), vector<float>{5, 12, 21, 32}, MIN_FLOAT_TOLERANCE_BITS));
+}
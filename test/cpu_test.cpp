@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <iostream>
 #include <list>
@@ -40,7 +41,10 @@
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
@@ -184,6 +188,118 @@ TEST(cpu_test, abc_tbb)
 }
 #endif // NGRAPH_TBB_ENABLE
 
+TEST(cpu_test, scheduler_respects_dependencies)
+{
+    // Two branches of ten kernels between a head and a tail, with a few exclusive kernels
+    vector<runtime::cpu::CPU_Scheduler::Task> tasks;
+    tasks.push_back({{}, 1, false});
+    for (size_t i = 1; i <= 20; i++)
+    {
+        size_t predecessor = (i == 1 || i == 11) ? 0 : i - 1;
+        tasks.push_back({{predecessor}, 100, i % 5 == 0});
+    }
+    tasks.push_back({{10, 20}, 1, false});
+
+    runtime::cpu::CPU_Scheduler scheduler(tasks, 4, 10);
+    vector<atomic<bool>> done(tasks.size());
+    atomic<size_t> running_exclusive{0};
+    atomic<bool> ordered{true};
+    for (size_t run = 0; run < 5; run++)
+    {
+        for (auto& d : done)
+        {
+            d = false;
+        }
+        scheduler.run([&](size_t task, size_t worker) {
+            EXPECT_LT(worker, scheduler.get_thread_count());
+            for (size_t predecessor : tasks[task].predecessors)
+            {
+                if (!done[predecessor])
+                {
+                    ordered = false;
+                }
+            }
+            if (tasks[task].exclusive && running_exclusive++ != 0)
+            {
+                ordered = false;
+            }
+            this_thread::sleep_for(chrono::microseconds(100));
+            if (tasks[task].exclusive)
+            {
+                running_exclusive--;
+            }
+            done[task] = true;
+        });
+        EXPECT_TRUE(
+            all_of(done.begin(), done.end(), [](const atomic<bool>& d) { return d.load(); }));
+    }
+    EXPECT_TRUE(ordered);
+
+    auto statistics = scheduler.get_statistics();
+    EXPECT_EQ(statistics.task_count, tasks.size());
+    EXPECT_EQ(statistics.total_cost, 2002);
+    EXPECT_EQ(statistics.critical_path_cost, 1002);
+    EXPECT_EQ(statistics.run_count, 5);
+
+    auto fail = [](size_t task, size_t /* worker */) {
+        if (task == 5)
+        {
+            throw ngraph_error("kernel failed");
+        }
+    };
+    EXPECT_THROW(scheduler.run(fail), ngraph_error);
+}
+
+TEST(cpu_test, scheduler_clusters_cheap_chains)
+{
+    vector<runtime::cpu::CPU_Scheduler::Task> tasks;
+    tasks.push_back({{}, 1, false});
+    tasks.push_back({{0}, 1, false});
+    tasks.push_back({{1}, 1, false});
+    // Branches after task 2 start new clusters
+    tasks.push_back({{2}, 1, false});
+    tasks.push_back({{2}, 1, false});
+
+    runtime::cpu::CPU_Scheduler scheduler(tasks, 2, 10);
+    EXPECT_EQ(scheduler.get_statistics().cluster_count, 3);
+
+    vector<size_t> order;
+    mutex order_mutex;
+    scheduler.run([&](size_t task, size_t /* worker */) {
+        lock_guard<mutex> lock(order_mutex);
+        order.push_back(task);
+    });
+    ASSERT_EQ(order.size(), 5);
+    EXPECT_EQ(vector<size_t>(order.begin(), order.begin() + 3), (vector<size_t>{0, 1, 2}));
+}
+
+TEST(cpu_test, scheduler_memory_dependencies)
+{
+    using MemoryAccess = runtime::cpu::CPU_Scheduler::MemoryAccess;
+    vector<runtime::cpu::CPU_Scheduler::Task> tasks(5, {{}, 1, false});
+    vector<vector<MemoryAccess>> accesses{
+        // 0 writes [0, 64) of space 0
+        {{0, 0, 64, true}},
+        // 1 reads it and writes [64, 128)
+        {{0, 0, 64, false}, {0, 64, 128, true}},
+        // 2 reads [0, 64) and writes another space
+        {{0, 0, 64, false}, {1, 0, 64, true}},
+        // 3 reuses [0, 128) once 1 and 2 are done with it
+        {{0, 0, 128, true}},
+        // 4 only touches a third space
+        {{2, 0, 64, true}}};
+    runtime::cpu::CPU_Scheduler::add_memory_dependencies(tasks, accesses);
+
+    EXPECT_EQ(tasks[0].predecessors, (vector<size_t>{}));
+    EXPECT_EQ(tasks[1].predecessors, (vector<size_t>{0}));
+    EXPECT_EQ(tasks[2].predecessors, (vector<size_t>{0}));
+    auto predecessors = tasks[3].predecessors;
+    sort(predecessors.begin(), predecessors.end());
+    predecessors.erase(unique(predecessors.begin(), predecessors.end()), predecessors.end());
+    EXPECT_EQ(predecessors, (vector<size_t>{0, 1, 2}));
+    EXPECT_EQ(tasks[4].predecessors, (vector<size_t>{}));
+}
+
 TEST(cpu_test, mkldnn_layouts)
 {
     Shape shape_a{1, 16, 2, 2};
@@ -2310,3 +2426,176 @@ TEST(cpu_test, one_hot_scalar_oob_in_3)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ(r_data[3], 0);
 }
+
+TEST(cpu_test, call_frame_bound_buffers)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Divide>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+    auto cf = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle)->get_call_frame();
+
+    using Buffer = runtime::cpu::CPU_CallBinding::Buffer;
+    auto binding =
+        cf->bind({Buffer(element::f32, shape)},
+                 {Buffer(element::f32, shape), Buffer(element::f32, shape, Strides{2, 1})});
+    EXPECT_EQ(binding.get_input_count(), 2);
+    EXPECT_EQ(binding.get_output_size(0), 4 * sizeof(float));
+
+    vector<float> av{2, 4, 8, 16};
+    vector<float> bv{1, 2, 4, 8};
+    vector<float> rv(4);
+    void* inputs[] = {av.data(), bv.data()};
+    void* outputs[] = {rv.data()};
+    cf->call(binding, outputs, inputs);
+    EXPECT_TRUE(test::all_close_f((vector<float>{2, 2, 2, 2}), rv, MIN_FLOAT_TOLERANCE_BITS));
+
+    bv = {2, 4, 8, 16};
+    cf->call(binding, outputs, inputs);
+    EXPECT_TRUE(test::all_close_f((vector<float>{1, 1, 1, 1}), rv, MIN_FLOAT_TOLERANCE_BITS));
+
+    // Calls on bound buffers never count as reusing cached inputs
+    auto statistics = cf->get_context_pool_statistics();
+    EXPECT_EQ(statistics.calls, 2);
+    EXPECT_EQ(statistics.cached_calls, 0);
+
+    // A binding only applies to the call frame that made it
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto D = make_shared<op::Parameter>(element::f32, shape);
+    auto other_handle = backend->compile(
+        make_shared<Function>(make_shared<op::Divide>(C, D), ParameterVector{C, D}));
+    auto other_cf =
+        dynamic_pointer_cast<runtime::cpu::CPU_Executable>(other_handle)->get_call_frame();
+    EXPECT_THROW(other_cf->call(binding, outputs, inputs), ngraph_error);
+
+    EXPECT_THROW(cf->bind({Buffer(element::f32, shape)}, {Buffer(element::f32, shape)}),
+                 ngraph_error);
+    EXPECT_THROW(cf->bind({Buffer(element::f32, shape)},
+                          {Buffer(element::f32, shape), Buffer(element::i32, shape)}),
+                 ngraph_error);
+    EXPECT_THROW(cf->bind({Buffer(element::f32, shape, Strides{1, 2})},
+                          {Buffer(element::f32, shape), Buffer(element::f32, shape)}),
+                 ngraph_error);
+}
+
+TEST(cpu_test, call_frame_context_pool)
+{
+    if (is_codegen_mode())
+    {
+        // TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    Shape shape{64};
+    // The backend caches executables by function, so each compilation gets its own
+    auto make_function = [&shape]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+    };
+    auto backend = runtime::Backend::create("CPU");
+
+    const size_t thread_count = 4;
+    const size_t call_count = 50;
+    auto run_concurrently = [&](const shared_ptr<runtime::Executable>& handle) {
+        vector<thread> threads;
+        for (size_t i = 0; i < thread_count; i++)
+        {
+            threads.emplace_back([&, i]() {
+                auto a = backend->create_tensor(element::f32, shape);
+                auto b = backend->create_tensor(element::f32, shape);
+                auto result = backend->create_tensor(element::f32, shape);
+                copy_data(b, vector<float>(shape_size(shape), 1));
+                for (size_t j = 0; j < call_count; j++)
+                {
+                    copy_data(a, vector<float>(shape_size(shape), static_cast<float>(i + j)));
+                    handle->call_with_validate({result}, {a, b});
+                    EXPECT_EQ(read_vector<float>(result),
+                              vector<float>(shape_size(shape), static_cast<float>(i + j + 1)));
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        return dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle)
+            ->get_call_frame()
+            ->get_context_pool_statistics();
+    };
+
+    // The pool keeps its NGRAPH_CPU_CONCURRENCY contexts unless allowed to grow
+    auto statistics = run_concurrently(backend->compile(make_function()));
+    EXPECT_EQ(statistics.calls, thread_count * call_count);
+    EXPECT_EQ(statistics.contexts, 1);
+    EXPECT_LE(statistics.affine_calls, statistics.calls);
+    EXPECT_LE(statistics.cached_calls, statistics.calls);
+
+    set_environment("NGRAPH_CPU_MAX_CONCURRENCY", "2", 1);
+    auto handle = backend->compile(make_function());
+    unset_environment("NGRAPH_CPU_MAX_CONCURRENCY");
+    statistics = run_concurrently(handle);
+    EXPECT_EQ(statistics.calls, thread_count * call_count);
+    EXPECT_GE(statistics.contexts, 1);
+    EXPECT_LE(statistics.contexts, 2);
+    EXPECT_LE(statistics.affine_calls, statistics.calls);
+}
+
+#if MKLDNN_VERSION_MAJOR >= 1
+TEST(cpu_test, mkldnn_primitive_cache)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 3, 7, 7});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{5, 3, 3, 3});
+        auto conv = make_shared<op::Convolution>(A,
+                                                 B,
+                                                 Strides{2, 2},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 Strides{1, 1});
+        return make_shared<Function>(NodeVector{conv}, ParameterVector{A, B});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    auto first = make_function();
+    for (shared_ptr<op::Parameter> param : first->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto& cache = runtime::cpu::MKLDNNPrimitiveCache::get();
+    auto first_results = execute(first, args, "CPU");
+    auto before = cache.get_statistics();
+
+    // A second function with the same convolution reuses its descriptor and primitive
+    auto second_results = execute(make_function(), args, "CPU");
+    auto after = cache.get_statistics();
+    EXPECT_EQ(after.entries, before.entries);
+    EXPECT_EQ(after.misses, before.misses);
+    EXPECT_GT(after.hits, before.hits);
+    EXPECT_EQ(after.primitive_misses, before.primitive_misses);
+    EXPECT_GT(after.primitive_hits, before.primitive_hits);
+    EXPECT_TRUE(test::all_close(second_results.at(0), first_results.at(0)));
+
+    // Bounding the cache keeps the most recently used entry, the convolution
+    size_t capacity = cache.get_capacity();
+    cache.set_capacity(1);
+    auto bounded = cache.get_statistics();
+    EXPECT_EQ(bounded.entries, 1);
+    EXPECT_EQ(bounded.evictions, after.evictions + after.entries - 1);
+    auto third_results = execute(make_function(), args, "CPU");
+    auto last = cache.get_statistics();
+    EXPECT_EQ(last.misses, bounded.misses);
+    EXPECT_GT(last.hits, bounded.hits);
+    EXPECT_TRUE(test::all_close(third_results.at(0), first_results.at(0)));
+    cache.set_capacity(capacity);
+}
+#endif
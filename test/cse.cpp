@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <numeric>
 
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
@@ -24,6 +25,7 @@
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/product.hpp"
@@ -335,6 +337,68 @@ TEST(CSE, one_hot)
     }
 }
 
+TEST(CSE, attributes)
+{
+    auto A = std::make_shared<op::Parameter>(element::i32, Shape{2, 3});
+    auto B = std::make_shared<op::Parameter>(element::i32, Shape{2, 3});
+    auto convert1 = std::make_shared<op::Convert>(A, element::f32);
+    auto convert2 = std::make_shared<op::Convert>(A, element::f32);
+    auto convert3 = std::make_shared<op::Convert>(A, element::f64);
+    auto div1 = std::make_shared<op::Divide>(A, B, true);
+    auto div2 = std::make_shared<op::Divide>(A, B, true);
+    auto div3 = std::make_shared<op::Divide>(A, B, false);
+    auto f = std::make_shared<Function>(NodeVector{convert1, convert2, convert3, div1, div2, div3},
+                                        ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(2)->get_argument(0));
+    ASSERT_EQ(f->get_results().at(3)->get_argument(0), f->get_results().at(4)->get_argument(0));
+    ASSERT_NE(f->get_results().at(3)->get_argument(0), f->get_results().at(5)->get_argument(0));
+}
+
+TEST(CSE, subtract_not_commutative)
+{
+    Shape zero_shape{0};
+    auto A = std::make_shared<op::Parameter>(element::i32, zero_shape);
+    auto B = std::make_shared<op::Parameter>(element::i32, zero_shape);
+    auto sub1 = std::make_shared<op::Subtract>(A, B);
+    auto sub2 = std::make_shared<op::Subtract>(B, A);
+    auto f = std::make_shared<Function>(NodeVector{sub1, sub2}, ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), sub1);
+    ASSERT_EQ(f->get_results().at(1)->get_argument(0), sub2);
+}
+
+TEST(CSE, constant_weights)
+{
+    Shape shape{64, 64};
+    vector<float> values(shape_size(shape));
+    iota(values.begin(), values.end(), 0.0f);
+    auto weights1 = op::Constant::create(element::f32, shape, values);
+    auto weights2 = op::Constant::create(element::f32, shape, values);
+    values.back() = 0.0f;
+    auto weights3 = op::Constant::create(element::f32, shape, values);
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto f = std::make_shared<Function>(
+        NodeVector{A * weights1, A * weights2, A * weights3}, ParameterVector{A});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    auto mul1 = f->get_results().at(0)->get_argument(0);
+    auto mul2 = f->get_results().at(1)->get_argument(0);
+    auto mul3 = f->get_results().at(2)->get_argument(0);
+    ASSERT_EQ(mul1, mul2);
+    ASSERT_NE(mul1, mul3);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 2);
+}
+
 TEST(CSE, pass_property)
 {
     auto pass = std::make_shared<ngraph::pass::CommonSubexpressionElimination>();
@@ -0,0 +1,167 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/in_place_elementwise.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static vector<op::util::oi_pair> get_in_place_oi_pairs(const shared_ptr<Node>& node)
+{
+    auto op_annotations = static_pointer_cast<op::Op>(node)->get_op_annotations();
+    return op_annotations ? op_annotations->get_in_place_oi_pairs()
+                          : vector<op::util::oi_pair>{};
+}
+
+TEST(in_place_elementwise, chain)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto exp = make_shared<op::Exp>(add);
+    auto mul = make_shared<op::Multiply>(B, exp);
+    auto tanh = make_shared<op::Tanh>(mul);
+    auto f = make_shared<Function>(make_shared<op::Negative>(tanh), ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::InPlaceElementwise>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+
+    // parameters are never overwritten
+    EXPECT_TRUE(get_in_place_oi_pairs(add).empty());
+    for (auto node : {static_pointer_cast<Node>(exp), static_pointer_cast<Node>(tanh)})
+    {
+        auto pairs = get_in_place_oi_pairs(node);
+        ASSERT_EQ(1, pairs.size());
+        EXPECT_EQ(0, pairs[0].input);
+        EXPECT_TRUE(pairs[0].destructive);
+    }
+    auto pairs = get_in_place_oi_pairs(mul);
+    ASSERT_EQ(1, pairs.size());
+    EXPECT_EQ(1, pairs[0].input);
+
+    // every intermediate shares one buffer
+    EXPECT_EQ(shape_size(shape) * sizeof(float), f->get_temporary_pool_size());
+    EXPECT_EQ(add->output(0).get_tensor().get_pool_offset(),
+              tanh->output(0).get_tensor().get_pool_offset());
+}
+
+TEST(in_place_elementwise, input_used_later)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto exp = make_shared<op::Exp>(A);
+    auto neg = make_shared<op::Negative>(exp);
+    auto add = make_shared<op::Add>(neg, exp);
+    auto f = make_shared<Function>(add, ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::InPlaceElementwise>();
+    pass_manager.run_passes(f);
+
+    // exp is still needed by add so neg must not overwrite it
+    EXPECT_TRUE(get_in_place_oi_pairs(neg).empty());
+    EXPECT_EQ(1, get_in_place_oi_pairs(add).size());
+}
+
+TEST(in_place_elementwise, without_liveness)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto exp = make_shared<op::Exp>(A);
+    auto neg = make_shared<op::Negative>(exp);
+    auto abs = make_shared<op::Abs>(exp);
+    auto sqrt = make_shared<op::Sqrt>(abs);
+    auto f = make_shared<Function>(NodeVector{neg, sqrt}, ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::InPlaceElementwise>();
+    pass_manager.run_passes(f);
+
+    // without liveness only a single consumer is known to be the last use
+    EXPECT_TRUE(get_in_place_oi_pairs(neg).empty());
+    EXPECT_TRUE(get_in_place_oi_pairs(abs).empty());
+    EXPECT_EQ(1, get_in_place_oi_pairs(sqrt).size());
+}
+
+TEST(in_place_elementwise, type_and_shape_mismatch)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto exp_a = make_shared<op::Exp>(A);
+    auto exp_b = make_shared<op::Exp>(B);
+    auto greater = make_shared<op::Greater>(exp_a, exp_b);
+    auto exp_c = make_shared<op::Exp>(C);
+    auto broadcast = make_shared<op::Broadcast>(exp_c, shape, AxisSet{0});
+    auto select = make_shared<op::Select>(greater, broadcast, exp_a);
+    auto f = make_shared<Function>(select, ParameterVector{A, B, C});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::InPlaceElementwise>();
+    pass_manager.run_passes(f);
+
+    EXPECT_TRUE(get_in_place_oi_pairs(greater).empty());
+    auto pairs = get_in_place_oi_pairs(select);
+    ASSERT_EQ(1, pairs.size());
+    EXPECT_EQ(1, pairs[0].input);
+}
+
+TEST(in_place_elementwise, interpreter)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto exp = make_shared<op::Exp>(A);
+    auto add = make_shared<op::Add>(exp, exp);
+    auto sub = make_shared<op::Subtract>(B, add);
+    auto f = make_shared<Function>(make_shared<op::Tanh>(sub), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{0, 1, -1, 0.5f});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{1, 2, 3, 4});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    vector<float> expected;
+    vector<float> a_values{0, 1, -1, 0.5f};
+    vector<float> b_values{1, 2, 3, 4};
+    for (size_t i = 0; i < a_values.size(); ++i)
+    {
+        expected.push_back(tanhf(b_values[i] - 2 * expf(a_values[i])));
+    }
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
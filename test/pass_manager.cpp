@@ -23,6 +23,7 @@
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "util/test_tools.hpp"
 
@@ -67,3 +68,35 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+TEST(pass_manager, pass_profiles)
+{
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.set_pass_profiling(true);
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.register_pass<pass::CoreFusion>();
+
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto zero = op::Constant::create(element::f32, shape, vector<float>{0, 0, 0, 0, 0, 0});
+    auto f = make_shared<Function>(make_shared<op::Maximum>(zero, A), ParameterVector{A});
+    pass_manager.run_passes(f);
+
+    auto& profiles = pass_manager.get_pass_profiles();
+    ASSERT_EQ(profiles.size(), 2);
+    EXPECT_NE(profiles[0].name.find("DummyPass"), string::npos);
+    EXPECT_EQ(profiles[0].node_count_before, 4);
+    EXPECT_EQ(profiles[0].node_count_after, 4);
+    EXPECT_EQ(profiles[0].nodes_created, 0);
+    EXPECT_EQ(profiles[0].rewrites, 0);
+
+    EXPECT_EQ(profiles[1].name, "ngraph::pass::CoreFusion");
+    EXPECT_EQ(profiles[1].node_count_before, 4);
+    EXPECT_EQ(profiles[1].node_count_after, 3);
+    EXPECT_EQ(profiles[1].nodes_created, 1);
+    EXPECT_EQ(profiles[1].rewrites, 1);
+#ifndef _WIN32
+    EXPECT_GT(profiles[1].peak_rss, 0);
+#endif
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -204,6 +205,95 @@ TEST(memory_manager, memory_align)
     EXPECT_EQ(128, mm.allocate(4));
 }
 
+TEST(memory_manager, offline_avoids_fragmentation)
+{
+    // first fit cannot put c where a was, since b is still live right behind it
+    pass::MemoryManager first_fit{1};
+    EXPECT_EQ(0, first_fit.allocate(10));
+    EXPECT_EQ(10, first_fit.allocate(10));
+    first_fit.free(0);
+    EXPECT_EQ(20, first_fit.allocate(20));
+    EXPECT_EQ(40, first_fit.max_allocated());
+
+    pass::MemoryManager mm{1, pass::MemoryManager::allocation_scheme::OFFLINE};
+    size_t a = mm.allocate(10);
+    size_t b = mm.allocate(10);
+    mm.free(a);
+    size_t c = mm.allocate(20);
+    EXPECT_EQ(30, mm.max_allocated());
+    EXPECT_EQ(30, mm.get_lower_bound());
+    EXPECT_EQ(0, mm.get_planned_offset(c));
+    EXPECT_EQ(0, mm.get_planned_offset(a));
+    EXPECT_EQ(20, mm.get_planned_offset(b));
+}
+
+TEST(memory_manager, offline_bad_free)
+{
+    pass::MemoryManager mm{1, pass::MemoryManager::allocation_scheme::OFFLINE};
+
+    EXPECT_THROW(mm.free(10), std::runtime_error);
+    size_t a = mm.allocate(10);
+    mm.free(a);
+    EXPECT_THROW(mm.free(a), std::runtime_error);
+}
+
+TEST(memory_manager, offline_random)
+{
+    struct allocation
+    {
+        size_t size;
+        size_t allocated;
+        size_t freed;
+        size_t placeholder;
+    };
+
+    std::default_random_engine engine(0);
+    for (size_t trial = 0; trial < 20; ++trial)
+    {
+        pass::MemoryManager mm{8, pass::MemoryManager::allocation_scheme::OFFLINE};
+        vector<allocation> allocations;
+        vector<size_t> live;
+        size_t time = 0;
+        for (size_t step = 0; step < 200; ++step)
+        {
+            if (!live.empty() && engine() % 3 == 0)
+            {
+                size_t i = engine() % live.size();
+                allocation& freed = allocations[live[i]];
+                mm.free(freed.placeholder);
+                freed.freed = time++;
+                live.erase(live.begin() + i);
+            }
+            else
+            {
+                size_t size = 1 + engine() % 1000;
+                live.push_back(allocations.size());
+                allocations.push_back(
+                    {size, time++, numeric_limits<size_t>::max(), mm.allocate(size)});
+            }
+        }
+
+        size_t max_allocated = mm.max_allocated();
+        EXPECT_GE(max_allocated, mm.get_lower_bound());
+        for (size_t i = 0; i < allocations.size(); ++i)
+        {
+            const allocation& x = allocations[i];
+            size_t x_offset = mm.get_planned_offset(x.placeholder);
+            EXPECT_EQ(0, x_offset % 8);
+            EXPECT_LE(x_offset + x.size, max_allocated);
+            for (size_t j = i + 1; j < allocations.size(); ++j)
+            {
+                const allocation& y = allocations[j];
+                if (x.allocated < y.freed && y.allocated < x.freed)
+                {
+                    size_t y_offset = mm.get_planned_offset(y.placeholder);
+                    EXPECT_TRUE(x_offset + x.size <= y_offset || y_offset + y.size <= x_offset);
+                }
+            }
+        }
+    }
+}
+
 TEST(memory_layout, basic)
 {
     pass::Manager pass_manager;
@@ -232,3 +322,29 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_layout, offline_planning)
+{
+    // x and y are live together, then y and z, where z is as large as x and y
+    Shape shape{10};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto x = make_shared<op::Negative>(A);
+    auto y = make_shared<op::Negative>(x);
+    auto z = make_shared<op::Broadcast>(y, Shape{2, 10}, AxisSet{0});
+    auto f = make_shared<Function>(make_shared<op::Sum>(z, AxisSet{0, 1}), ParameterVector{A});
+
+    pass::Manager first_fit;
+    first_fit.register_pass<pass::Liveness>();
+    first_fit.register_pass<pass::MemoryLayout>();
+    first_fit.run_passes(f);
+    EXPECT_EQ(160, f->get_temporary_pool_size());
+
+    pass::Manager offline;
+    offline.register_pass<pass::Liveness>();
+    offline.register_pass<pass::MemoryLayout>(1, false, true);
+    offline.run_passes(f);
+    EXPECT_EQ(120, f->get_temporary_pool_size());
+    EXPECT_EQ(0, z->output(0).get_tensor().get_pool_offset());
+    EXPECT_EQ(0, x->output(0).get_tensor().get_pool_offset());
+    EXPECT_EQ(80, y->output(0).get_tensor().get_pool_offset());
+}
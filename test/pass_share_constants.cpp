@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/share_constants.hpp"
+#include "ngraph/runtime/constant_store.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Function> make_weighted_function(float first_weight)
+{
+    Shape shape{16, 16};
+    vector<float> weights(shape_size(shape));
+    iota(weights.begin(), weights.end(), first_weight);
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto W = op::Constant::create(element::f32, shape, weights);
+    return make_shared<Function>(A * W, ParameterVector{A});
+}
+
+static const void* get_weight_data(const shared_ptr<Function>& f)
+{
+    for (auto node : f->get_ops())
+    {
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            return constant->get_data_ptr();
+        }
+    }
+    return nullptr;
+}
+
+TEST(share_constants, independent_functions)
+{
+    auto f1 = make_weighted_function(1.0f);
+    auto f2 = make_weighted_function(1.0f);
+    auto f3 = make_weighted_function(2.0f);
+    EXPECT_NE(get_weight_data(f1), get_weight_data(f2));
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ShareConstants>();
+    pass_manager.run_passes(f1);
+    pass_manager.run_passes(f2);
+    pass_manager.run_passes(f3);
+
+    EXPECT_EQ(get_weight_data(f1), get_weight_data(f2));
+    EXPECT_NE(get_weight_data(f1), get_weight_data(f3));
+    EXPECT_EQ(count_ops_of_type<op::Constant>(f2), 1);
+}
+
+TEST(share_constants, buffers_are_released)
+{
+    auto& store = runtime::ConstantStore::get();
+    size_t initial_count = store.get_buffer_count();
+
+    auto f1 = make_weighted_function(1000.0f);
+    auto f2 = make_weighted_function(1000.0f);
+    {
+        // The manager keeps the last function it ran on alive
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ShareConstants>();
+        pass_manager.run_passes(f1);
+        pass_manager.run_passes(f2);
+    }
+    EXPECT_EQ(store.get_buffer_count(), initial_count + 1);
+
+    // The buffer stays alive as long as one function uses it
+    f1 = nullptr;
+    EXPECT_EQ(store.get_buffer_count(), initial_count + 1);
+    f2 = nullptr;
+    EXPECT_EQ(store.get_buffer_count(), initial_count);
+}
@@ -295,6 +295,30 @@ TEST(pattern, graph_rewrite)
     }
 }
 
+TEST(pattern, graph_rewrite_statistics)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+    auto iconst1 = construct_constant_node(1);
+    auto graph = (a * iconst1) + b;
+    auto f = make_shared<Function>(graph, ParameterVector{a, b});
+
+    TestGraphRewrite pass;
+    pass.run_on_function(f);
+    ASSERT_EQ(graph->get_arguments().at(0), a);
+
+    // Each matcher is only tried on the node with the op type of its pattern root
+    auto& statistics = pass.get_matcher_statistics();
+    ASSERT_EQ(statistics.size(), 2);
+    EXPECT_EQ(statistics[0].attempts, 1);
+    EXPECT_EQ(statistics[0].matches, 1);
+    EXPECT_EQ(statistics[0].rewrites, 1);
+    EXPECT_EQ(statistics[1].attempts, 1);
+    EXPECT_EQ(statistics[1].matches, 0);
+    EXPECT_EQ(statistics[1].rewrites, 0);
+}
+
 TEST(pattern, matcher)
 {
     Shape shape{};
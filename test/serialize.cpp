@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <numeric>
 #include <sstream>
 
 #include "gmock/gmock.h"
@@ -194,6 +195,76 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, binary)
+{
+    const string tmp_file = "serialize_binary.ngb";
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto C = op::Constant::create(element::i64, Shape{2}, {3, 2});
+    auto D = op::Constant::create(element::boolean, Shape{3}, {1, 0, 1});
+    vector<float> large_values(4096);
+    iota(large_values.begin(), large_values.end(), 0.0f);
+    auto E = op::Constant::create(element::f32, Shape{4096}, large_values);
+    auto R = make_shared<op::Reshape>(A + B, AxisVector{0, 1}, Shape{3, 2});
+    auto f = make_shared<Function>(NodeVector{R, C, D, E}, ParameterVector{A});
+
+    serialize_binary(tmp_file, f);
+    auto g = deserialize(tmp_file);
+    // The constants keep the mapping alive
+    file_util::remove_file(tmp_file);
+    ASSERT_NE(g, nullptr);
+    EXPECT_EQ(g->get_parameters().size(), 1);
+    ASSERT_EQ(g->get_output_size(), 4);
+    EXPECT_EQ(g->get_output_shape(0), (Shape{3, 2}));
+
+    size_t constants = 0;
+    for (shared_ptr<Node> node : g->get_ops())
+    {
+        if (auto c = as_type_ptr<op::Constant>(node))
+        {
+            constants++;
+            // Constants reference the aligned data in the file
+            size_t address = reinterpret_cast<size_t>(c->get_data_ptr());
+            if (shape_size(c->get_shape()) == large_values.size())
+            {
+                EXPECT_EQ(address % 4096, 0);
+                EXPECT_EQ(c->get_vector<float>(), large_values);
+            }
+            else if (c->get_element_type() == element::f32)
+            {
+                EXPECT_EQ(address % 64, 0);
+                EXPECT_EQ(c->get_vector<float>(), (vector<float>{1, 2, 3, 4, 5, 6}));
+            }
+            else if (c->get_element_type() == element::i64)
+            {
+                EXPECT_EQ(c->get_vector<int64_t>(), (vector<int64_t>{3, 2}));
+            }
+            else
+            {
+                EXPECT_EQ(c->get_vector<char>(), (vector<char>{1, 0, 1}));
+            }
+        }
+    }
+    EXPECT_EQ(constants, 4);
+}
+
+TEST(serialize, binary_stream)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto B = op::Constant::create(element::f32, Shape{4}, {1, 2, 3, 4});
+    auto f = make_shared<Function>(A * B, ParameterVector{A});
+
+    stringstream ss;
+    serialize_binary(ss, f);
+    auto g = deserialize(ss);
+    ASSERT_NE(g, nullptr);
+    auto multiply = g->get_results().at(0)->get_argument(0);
+    EXPECT_TRUE(is_type<op::Multiply>(multiply));
+    auto c = as_type_ptr<op::Constant>(multiply->get_argument(1));
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(c->get_vector<float>(), (vector<float>{1, 2, 3, 4}));
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
@@ -0,0 +1,201 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Collects (offset_a, offset_b) for every element visited
+static vector<pair<size_t, size_t>> visit(const StridedRange& range)
+{
+    vector<pair<size_t, size_t>> offsets;
+    range.for_each([&](size_t a, size_t b) {
+        for (size_t i = 0; i < range.get_run_length(); i++)
+        {
+            offsets.push_back({a + i * range.get_run_stride_a(), b + i * range.get_run_stride_b()});
+        }
+    });
+    return offsets;
+}
+
+TEST(strided_range, scalar)
+{
+    StridedRange range(Shape{}, {}, {}, 3, 5);
+    EXPECT_EQ(range.get_run_length(), 1);
+    EXPECT_EQ(range.get_run_count(), 1);
+    EXPECT_EQ(visit(range), (vector<pair<size_t, size_t>>{{3, 5}}));
+}
+
+TEST(strided_range, empty)
+{
+    StridedRange range(Shape{2, 0, 3}, {0, 3, 1}, {0, 3, 1});
+    EXPECT_EQ(range.get_run_count(), 0);
+    EXPECT_TRUE(visit(range).empty());
+}
+
+TEST(strided_range, contiguous_axes_merged)
+{
+    Shape shape{2, 3, 4};
+    StridedRange range(shape, StridedRange::strides(shape), StridedRange::strides(shape));
+    EXPECT_EQ(range.get_run_length(), 24);
+    EXPECT_EQ(range.get_run_count(), 1);
+    EXPECT_EQ(range.get_run_stride_a(), 1);
+}
+
+TEST(strided_range, unit_axes_dropped)
+{
+    Shape shape{1, 3, 1, 2};
+    StridedRange range(shape, {6, 2, 2, 1}, {0, 1, 0, 3});
+    EXPECT_EQ(range.get_run_length(), 2);
+    EXPECT_EQ(range.get_run_count(), 3);
+    EXPECT_EQ(visit(range),
+              (vector<pair<size_t, size_t>>{{0, 0}, {1, 3}, {2, 1}, {3, 4}, {4, 2}, {5, 5}}));
+}
+
+TEST(strided_range, negative_strides)
+{
+    // Reverse axis 1 of a 2x3 tensor
+    StridedRange range(Shape{2, 3}, {3, 1}, {3, -1}, 0, 2);
+    EXPECT_EQ(visit(range),
+              (vector<pair<size_t, size_t>>{{0, 2}, {1, 1}, {2, 0}, {3, 5}, {4, 4}, {5, 3}}));
+}
+
+TEST(strided_range, reduction)
+{
+    // Reduce axis 1 of a 2x2x3 tensor into a 2x3 output
+    StridedRange range = StridedRange::reduction(Shape{2, 2, 3}, AxisSet{1});
+    EXPECT_EQ(range.get_run_length(), 3);
+    EXPECT_EQ(range.get_run_count(), 4);
+    vector<size_t> out_offsets;
+    for (auto& offsets : visit(range))
+    {
+        out_offsets.push_back(offsets.second);
+    }
+    EXPECT_EQ(out_offsets, (vector<size_t>{0, 1, 2, 0, 1, 2, 3, 4, 5, 3, 4, 5}));
+}
+
+TEST(strided_range, partial_reduction)
+{
+    // Rows [1, 3) of reducing axis 1 of a 4x2x3 tensor into a 4x3 output
+    StridedRange range = StridedRange::reduction(Shape{4, 2, 3}, AxisSet{1}, 1, 3);
+    EXPECT_EQ(range.get_run_count(), 4);
+    vector<pair<size_t, size_t>> offsets = visit(range);
+    ASSERT_EQ(offsets.size(), 12);
+    EXPECT_EQ(offsets.front(), (pair<size_t, size_t>{6, 3}));
+    EXPECT_EQ(offsets.back(), (pair<size_t, size_t>{17, 8}));
+
+    EXPECT_ANY_THROW(StridedRange::reduction(Shape{4, 2, 3}, AxisSet{0}, 0, 2));
+    EXPECT_ANY_THROW(StridedRange::reduction(Shape{4, 2, 3}, AxisSet{1}, 2, 5));
+}
+
+// Times the reference kernels ported to StridedRange against the same loops written with
+// CoordinateTransform
+TEST(strided_range, DISABLED_benchmark_reference_kernels)
+{
+    Shape in_shape{64, 128, 128};
+    Shape out_shape{128, 128};
+    AxisSet axes{0};
+    vector<float> in(shape_size(in_shape), 1);
+    vector<float> out(shape_size(out_shape));
+    vector<float> big(shape_size(in_shape));
+    constexpr size_t iterations = 10;
+    stopwatch sw;
+
+    auto report = [&](const string& name, size_t strided_ns, size_t coordinate_ns) {
+        cout << name << ": StridedRange " << strided_ns / iterations / 1000
+             << " us, CoordinateTransform " << coordinate_ns / iterations / 1000 << " us" << endl;
+    };
+
+    // Sum over axis 0
+    sw.start();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        runtime::reference::sum(in.data(), out.data(), in_shape, out_shape, axes);
+    }
+    sw.stop();
+    size_t strided_ns = sw.get_nanoseconds();
+    sw.start();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        CoordinateTransform output_transform(out_shape);
+        CoordinateTransform input_transform(in_shape);
+        fill(out.begin(), out.end(), 0);
+        for (const Coordinate& input_coord : input_transform)
+        {
+            out[output_transform.index(reduce(input_coord, axes))] +=
+                in[input_transform.index(input_coord)];
+        }
+    }
+    sw.stop();
+    report("sum", strided_ns, sw.get_nanoseconds());
+
+    // Broadcast along axis 0
+    sw.start();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        runtime::reference::broadcast(out.data(), big.data(), out_shape, in_shape, axes);
+    }
+    sw.stop();
+    strided_ns = sw.get_nanoseconds();
+    sw.start();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        CoordinateTransform input_transform(out_shape);
+        CoordinateTransform output_transform(in_shape);
+        for (const Coordinate& output_coord : output_transform)
+        {
+            big[output_transform.index(output_coord)] =
+                out[input_transform.index(reduce(output_coord, axes))];
+        }
+    }
+    sw.stop();
+    report("broadcast", strided_ns, sw.get_nanoseconds());
+
+    // Transpose
+    AxisVector order{2, 0, 1};
+    Shape transposed_shape{128, 64, 128};
+    sw.start();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        runtime::reference::reshape(in.data(), big.data(), in_shape, order, transposed_shape);
+    }
+    sw.stop();
+    strided_ns = sw.get_nanoseconds();
+    sw.start();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        CoordinateTransform input_transform(
+            in_shape, Coordinate(3, 0), in_shape, Strides(3, 1), order);
+        CoordinateTransform output_transform(transposed_shape);
+        auto output_it = output_transform.begin();
+        for (const Coordinate& input_coord : input_transform)
+        {
+            big[output_transform.index(*output_it)] = in[input_transform.index(input_coord)];
+            ++output_it;
+        }
+    }
+    sw.stop();
+    report("reshape", strided_ns, sw.get_nanoseconds());
+}
@@ -0,0 +1,246 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Enough work per item for parallel_for to split any count above one
+static constexpr size_t heavy_item = 1 << 20;
+
+TEST(thread_pool, inline_without_pool)
+{
+    vector<pair<size_t, size_t>> calls;
+    runtime::parallel_for(100, heavy_item, [&](size_t begin, size_t end) {
+        calls.push_back({begin, end});
+    });
+    EXPECT_EQ(calls, (vector<pair<size_t, size_t>>{{0, 100}}));
+}
+
+TEST(thread_pool, inline_when_cheap)
+{
+    runtime::ThreadPool pool(4);
+    runtime::ThreadPool::Scope scope(&pool);
+    size_t calls = 0;
+    runtime::parallel_for(100, 1, [&](size_t /* begin */, size_t /* end */) { calls++; });
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(thread_pool, covers_range_once)
+{
+    runtime::ThreadPool pool(4);
+    EXPECT_EQ(pool.get_thread_count(), 4);
+    runtime::ThreadPool::Scope scope(&pool);
+    EXPECT_EQ(runtime::ThreadPool::get_current(), &pool);
+
+    for (size_t count : {1, 2, 3, 7, 64, 1000})
+    {
+        vector<atomic<size_t>> visits(count);
+        for (auto& v : visits)
+        {
+            v = 0;
+        }
+        atomic<size_t> chunks{0};
+        runtime::parallel_for(count, heavy_item, [&](size_t begin, size_t end) {
+            chunks++;
+            for (size_t i = begin; i < end; i++)
+            {
+                visits[i]++;
+            }
+        });
+        for (auto& v : visits)
+        {
+            EXPECT_EQ(v.load(), 1);
+        }
+        EXPECT_EQ(chunks.load(), min<size_t>(count, pool.get_thread_count() * 4));
+    }
+}
+
+TEST(thread_pool, scope_restores_previous)
+{
+    runtime::ThreadPool pool(2);
+    EXPECT_EQ(runtime::ThreadPool::get_current(), nullptr);
+    {
+        runtime::ThreadPool::Scope scope(&pool);
+        {
+            runtime::ThreadPool::Scope inner(nullptr);
+            EXPECT_EQ(runtime::ThreadPool::get_current(), nullptr);
+        }
+        EXPECT_EQ(runtime::ThreadPool::get_current(), &pool);
+    }
+    EXPECT_EQ(runtime::ThreadPool::get_current(), nullptr);
+}
+
+TEST(thread_pool, exception_rethrown)
+{
+    runtime::ThreadPool pool(4);
+    runtime::ThreadPool::Scope scope(&pool);
+    EXPECT_THROW(runtime::parallel_for(64,
+                                       heavy_item,
+                                       [&](size_t begin, size_t /* end */) {
+                                           if (begin != 0)
+                                           {
+                                               throw runtime_error("chunk failed");
+                                           }
+                                       }),
+                 runtime_error);
+
+    // The pool is still usable
+    atomic<size_t> total{0};
+    runtime::parallel_for(64, heavy_item, [&](size_t begin, size_t end) { total += end - begin; });
+    EXPECT_EQ(total.load(), 64);
+}
+
+TEST(thread_pool, nested_runs_inline)
+{
+    runtime::ThreadPool pool(4);
+    runtime::ThreadPool::Scope scope(&pool);
+    atomic<size_t> inner_calls{0};
+    atomic<size_t> total{0};
+    runtime::parallel_for(16, heavy_item, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            runtime::parallel_for(16, heavy_item, [&](size_t inner_begin, size_t inner_end) {
+                inner_calls++;
+                total += inner_end - inner_begin;
+            });
+        }
+    });
+    EXPECT_EQ(inner_calls.load(), 16);
+    EXPECT_EQ(total.load(), 16 * 16);
+}
+
+TEST(thread_pool, concurrent_callers)
+{
+    // A pool busy with one caller's parallel_for makes the other callers run inline
+    runtime::ThreadPool pool(2);
+    vector<thread> callers;
+    atomic<size_t> total{0};
+    for (size_t t = 0; t < 4; t++)
+    {
+        callers.emplace_back([&]() {
+            runtime::ThreadPool::Scope scope(&pool);
+            for (size_t i = 0; i < 100; i++)
+            {
+                runtime::parallel_for(
+                    32, heavy_item, [&](size_t begin, size_t end) { total += end - begin; });
+            }
+        });
+    }
+    for (thread& caller : callers)
+    {
+        caller.join();
+    }
+    EXPECT_EQ(total.load(), 4 * 100 * 32);
+}
+
+// The parallel kernels keep the order in which every output element accumulates its inputs, so
+// they must match the serial results exactly
+TEST(thread_pool, kernels_match_serial)
+{
+    default_random_engine engine(0);
+    uniform_real_distribution<float> distribution(-1.f, 1.f);
+    auto random_vector = [&](size_t size) {
+        vector<float> v(size);
+        generate(v.begin(), v.end(), [&]() { return distribution(engine); });
+        return v;
+    };
+    runtime::ThreadPool pool(4);
+
+    auto run_both = [&](function<void(vector<float>&)> kernel, size_t out_size) {
+        vector<float> serial(out_size);
+        vector<float> parallel(out_size);
+        kernel(serial);
+        runtime::ThreadPool::Scope scope(&pool);
+        kernel(parallel);
+        EXPECT_EQ(serial, parallel);
+    };
+
+    Shape in_shape{64, 96, 80};
+    vector<float> in = random_vector(shape_size(in_shape));
+    run_both(
+        [&](vector<float>& out) {
+            runtime::reference::sum(in.data(), out.data(), in_shape, Shape{64, 80}, AxisSet{1});
+        },
+        64 * 80);
+
+    size_t m = 130;
+    size_t k = 300;
+    size_t n = 520;
+    vector<float> a = random_vector(m * k);
+    vector<float> b = random_vector(k * n);
+    run_both(
+        [&](vector<float>& out) {
+            runtime::reference::matmul<float, float, float, float>(
+                a.data(), b.data(), out.data(), m, k, n);
+        },
+        m * n);
+
+    Shape pool_in_shape{4, 16, 65, 65};
+    Shape pool_out_shape{4, 16, 32, 32};
+    vector<float> pool_in = random_vector(shape_size(pool_in_shape));
+    run_both(
+        [&](vector<float>& out) {
+            runtime::reference::max_pool(pool_in.data(),
+                                         out.data(),
+                                         pool_in_shape,
+                                         pool_out_shape,
+                                         Shape{3, 3},
+                                         Strides{2, 2},
+                                         Shape{0, 0},
+                                         Shape{0, 0});
+        },
+        shape_size(pool_out_shape));
+}
+
+// Times a matrix product on pools of increasing size
+TEST(thread_pool, DISABLED_benchmark_matmul)
+{
+    size_t m = 1024;
+    size_t k = 1024;
+    size_t n = 1024;
+    vector<float> a(m * k, 1);
+    vector<float> b(k * n, 1);
+    vector<float> out(m * n);
+    stopwatch sw;
+    for (size_t thread_count = 1; thread_count <= thread::hardware_concurrency();
+         thread_count *= 2)
+    {
+        runtime::ThreadPool pool(thread_count);
+        runtime::ThreadPool::Scope scope(&pool);
+        sw.start();
+        runtime::reference::matmul<float, float, float, float>(
+            a.data(), b.data(), out.data(), m, k, n);
+        sw.stop();
+        cout << thread_count << " threads: " << sw.get_milliseconds() << " ms" << endl;
+    }
+}
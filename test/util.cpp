@@ -712,3 +712,133 @@ TEST(util, topological_sort_replace)
 
     EXPECT_TRUE(custom_sorter_used);
 }
+
+TEST(util, ordered_ops_cached)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, ParameterVector{A, B});
+    size_t sort_count = 0;
+    f->set_topological_sort([&sort_count](const std::vector<std::shared_ptr<Node>>& root_nodes) {
+        sort_count++;
+        return topological_sort(root_nodes);
+    });
+
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(f->get_ordered_ops(), ops);
+    EXPECT_EQ(sort_count, 1);
+
+    // Constructing a new user of a node in the function does not change the function
+    auto unused = make_shared<op::Negative>(A);
+    EXPECT_EQ(f->get_ordered_ops(), ops);
+    EXPECT_EQ(sort_count, 1);
+}
+
+TEST(util, ordered_ops_cache_replace_node)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto f = make_shared<Function>(add, ParameterVector{A, B});
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+
+    auto neg = make_shared<op::Negative>(A);
+    auto mul = make_shared<op::Multiply>(neg, B);
+    replace_node(add, mul);
+    auto ops = f->get_ordered_ops();
+    ASSERT_EQ(ops.size(), 5);
+    EXPECT_NE(find(ops.begin(), ops.end(), neg), ops.end());
+    EXPECT_EQ(find(ops.begin(), ops.end(), add), ops.end());
+    EXPECT_LT(find(ops.begin(), ops.end(), neg) - ops.begin(),
+              find(ops.begin(), ops.end(), mul) - ops.begin());
+}
+
+TEST(util, ordered_ops_cache_control_dependency)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto neg_a = make_shared<op::Negative>(A);
+    auto neg_b = make_shared<op::Negative>(B);
+    auto f = make_shared<Function>(NodeVector{neg_a, neg_b}, ParameterVector{A, B});
+    auto position = [&f](const shared_ptr<Node>& node) {
+        auto ops = f->get_ordered_ops();
+        return find(ops.begin(), ops.end(), node) - ops.begin();
+    };
+
+    neg_a->add_control_dependency(neg_b);
+    EXPECT_LT(position(neg_b), position(neg_a));
+    neg_a->remove_control_dependency(neg_b);
+    neg_b->add_control_dependency(neg_a);
+    EXPECT_LT(position(neg_a), position(neg_b));
+    neg_b->clear_control_dependencies();
+    neg_a->add_control_dependency(neg_b);
+    EXPECT_LT(position(neg_b), position(neg_a));
+}
+
+TEST(util, ordered_ops_cache_replace_parameter)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, ParameterVector{A, B});
+    f->get_ordered_ops();
+
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    f->replace_parameter(1, C);
+    auto ops = f->get_ordered_ops();
+    EXPECT_NE(find(ops.begin(), ops.end(), C), ops.end());
+    EXPECT_EQ(find(ops.begin(), ops.end(), B), ops.end());
+}
+
+TEST(util, ordered_ops_cache_shared_nodes)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto f1 = make_shared<Function>(make_shared<op::Negative>(add), ParameterVector{A, B});
+    auto f2 = make_shared<Function>(make_shared<op::Abs>(add), ParameterVector{A, B});
+    EXPECT_EQ(f1->get_ordered_ops().size(), 5);
+    EXPECT_EQ(f2->get_ordered_ops().size(), 5);
+
+    // A change to a node shared by both functions invalidates both caches
+    add->add_control_dependency(make_shared<op::Parameter>(element::f32, shape));
+    EXPECT_EQ(f1->get_ordered_ops().size(), 6);
+    EXPECT_EQ(f2->get_ordered_ops().size(), 6);
+}
+
+TEST(util, DISABLED_benchmark_ordered_ops)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{3, 3});
+    shared_ptr<Node> n = param;
+    for (size_t i = 0; i < 100000; i++)
+    {
+        n = make_shared<op::Negative>(n);
+    }
+    auto f = make_shared<Function>(n, ParameterVector{param});
+
+    constexpr size_t num_iterations = 100;
+    stopwatch sw;
+    sw.start();
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        topological_sort(NodeVector{f->get_result(), param});
+    }
+    sw.stop();
+    size_t sort_us = sw.get_microseconds() / num_iterations;
+
+    f->get_ordered_ops();
+    sw.start();
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        f->get_ordered_ops();
+    }
+    sw.stop();
+    size_t cached_us = sw.get_microseconds() / num_iterations;
+
+    std::cout << "topological_sort: " << sort_us << "us, get_ordered_ops: " << cached_us
+              << "us" << std::endl;
+}